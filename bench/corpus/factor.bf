@@ -0,0 +1,56 @@
+prime factors of the number on each input line below 256 until a line with 0
+>>>>>>>>>>>>>>[-]+[<<[-]>,----------[-------------------------------------->>>>>[-]<<<<<<[->>>>>>++++++++++<<<<<<]>>>>>>
+[-<<<<<<+>>>>>>]<<<<<[-<+>],----------]>[-]>>>>>>>[-]>[-]<<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>
+>>>>>]<[<<<<<<<[-]+>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++<[-]++++++++++<<<<<<<<<<<<[-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<+<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>
+>>+<<<<<<<<<<<<]>>>>>>>>[-]<<<<<<<<[-]>>>>[-]>>>>>>>[-<<<<<<<<<<<+>>>>+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[-]>[-]>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<-<<<<+>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>+<<<<<<<<[-]>>>>[-]>>>>>>>[-<<<<<<<<<<<+>>>>+>>>
+>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]
+>]>>>>[-]<<<<<<<<<<[-]>>>>>>>>>>>[-<+<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>[-]<<<<<<<<<[-
+]>>>>[-]>>>>>>[-<<<<<<<<<<+>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>
+-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<-<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<]>>+<<<<<<<<<[-]>>>>[-]>>>>>>[-<<<<<<<<<<+>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-
+]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>>>>>>>>>>>>[-]<<<<[-]>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>+
+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[>>>>[-]+<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++
+++++++++++++++++++.>>>>>>>>>>>>>[-]]>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>][-]<<[->+>+<<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++
++++++++++++++++++++.>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>>>>>>>>
+>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]++>>>>>[-]+<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[-]>[-
+]>>>>>>>>[-<<<<<<<<<+>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>
+>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>[<[-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[->>>>>+<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>[-<<<<<<<<<<<<+>+>>>>
+>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[
+-]>>>>>>>>[->>-<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>+<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>[-<<<<<<<<<<<<+>+>>>>>>>>>>
+>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>
+>>>>>[-]+>>[-]>[-]<<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<[<<[-]<<<<+>>>>>>[-]]<<[[-]>>>>>>>>>[-]+++++++++++++++++++++++
++++++++++.<<<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<[-
+]++++++++++<<<<<<<<<<<<[-]<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<+<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<]>>>>>>>>[-]<<<<<<<<[-]>>>>[-]>>>>>>>[-<<<<<<<<<<<+>>>>+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[-]>[-]>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<-<<<<
++>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>+<<<<<<<<[-]>>>>[-]>>>>>>>[-<<<<<<<<<<<+>>>>+
+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->
+-<]>]>>>>[-]<<<<<<<<<<[-]>>>>>>>>>>>[-<+<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>[-]<<<<<<<<
+<[-]>>>>[-]>>>>>>[-<<<<<<<<<<+>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>+>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>-
+>]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<-<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<]>>+<<<<<<<<<[-]>>>>[-]>>>>>>[-<<<<<<<<<<+>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<
+<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>>>>>>>>>>>>[-]<<<<[-]>[-]<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<[>>>>[-]+<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++
++++++++++++++++++++++.>>>>>>>>>>>>>[-]]>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>][-]<<[->+>+<<]>>[-<<+>>]<[[-]<<<<<<<<<<<<<<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>[-]>>>>[-<<<
+<+>>>>]>>>]<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>[-<<<<<<<<<+>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>>>[-]<<<
+<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>]>>>>>>>>>>[-]++
+++++++++.<<<<<<<[-]]<<<<<<<]
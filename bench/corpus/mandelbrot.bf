@@ -0,0 +1,115 @@
+ascii mandelbrot set 32 by 21 in fixed point with 3 fraction bits and 16 iterations
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++>[-]++++>[-]++++++++++++++++++++++++++++++++>[-]++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++>[-]++++++++++++++++>[-]++++++++++++++++<<<<<<<<<<<<<<<<<<<<<<<<[-]+++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>[-]+++++++++++++++++++++[<[-]++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++>>[-]++++++++++++++++++++++++++++++++[>[-]>[-]>[-]>[-]>[-]>[-]+>[-]+<[>>>>>>[-]>>>>
+>>>>>>[-]>>[-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<[>>[-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<-]<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<
+<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<
+<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>[-]>>[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+
+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[>>[-]<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<-]<<<<<<<<<<<[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-
+]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<-<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>[-]<<<<<
+<<<<<<<<<<<[->>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<<<<[-
+>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<[[-]>>>>>>>>[-]<<<<<<<<<<<<<<<<<[-]>[-]>>>>
+>>>>]>>>>>>>>[[-]<<<<<<<<<<<[-]>>>>>>>>>>[-]>>[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<[>>[-]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>+>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<-]<<<<<<<<<<<[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>[-]<<<[-]>[<<[-
+]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>[>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<-<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>[-]<<<[-]>[<<[-]+<[->-]>[<>>>>>[-]+<<<<<>->]>-]<<<[-]>>>>>>[-]+<[->-<]>]>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]<<<<<<<<<<<<<<<<[->>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>[->>>-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<[-]>>>>>>>
+>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>][-]<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<->[-]+<[[-]>[-]>>>>>>>>>[-]<<<<<<<<<<<<<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>]<<<<<<<<<<]>[[-]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[->>>-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>>>>>>>>[[-]<<<<<<<<[-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>
+>>>>>>[-]<<<<<[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<<<<-<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<[[-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[-<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<-<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-]<
+<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]+>>>>>>>>[[-]<<<<<<<<[-]<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]<<<<<[-<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<-<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<[[-]<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<[-<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<]>>>
+>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<-<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>]<<<<
+<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<[->>>>>>>>-<<<<<<<<]>>>>>>>>[[-]
+<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<+>>>>+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<
+<<<<<[->>>>>>>>-<<<<<<<<]>>>>>>>>[[-]<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<+>>>>>>[-]>>>>>>>>>>>>>[
+-]<<<<<<<<<<<<<<<<<<<[->>>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>[-]+<<<<[[-]>>>>[-]<<<<]>>>>[[-]<<<<<<<<<[-]>>>>>>>>>]>>>>>>>>]<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<
+<<<<[[-]>>>>>>>>>>>>>>>>[-]>>[-]+++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[[-]<<<<<<<<<<<<[
+-]++++<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-]+>>[[-]<<[-]<<[-]++<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>+>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]+<<[[-]>>[-]>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<]>>[[-]>>>>>>>>>>>[-]+++
++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<]>]<<[[-]>>>>>>>>>>>>[-]+++++++++++++++++++++++++++++++++++++++++
+++.<<<<<<<<<<<<]>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<+>>-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>-]
@@ -0,0 +1,56 @@
+squares of 0 to 100 one per line
+>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++<<<<<[-]+>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++[<<<<<[-]>[-]>[-]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>][
+-]<<[->+>+<<]>>[-<<+>>]<[[-]<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.-----------------------------------
+------------->>>>>>>[-]+>][-]>[-]<<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>][-]<<[->+>+<<]>>[-
+<<+>>]<[[-]<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>
+>>>>>[-]+>][-]>[-]<<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>][-]<<[->+>+<<]>>[-<<+>>]<[[
+-]<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>>>>[-
+]+>][-]>[-]<<<<<<<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>][-]<<[->+>+<<]>>[-<<+>>]<[[-
+]<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>>>>>[
+-]+>]<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.------------------------------------------------>>>>>>
+>>>>>>>>>>>[-]++++++++++.<<<[-]<[-]<<<<<<<<[-<<<<<+>>>>>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>[-<<<<<<<<<<<<+>>>>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]<[-]
+>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<<<<<<<<---------->>>>>>>>>>>>>>[-]+<<]>[-]
+<<<<<<<[-<<<<<+>>>>>>>>>>>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]>>>>[-]>>>>>>>>>[-<<<<<<<<<<<<<+>>>>+>>>>>>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>
+>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<<<<<<<---------->>>>>>>>>>>>>[-]+<<]>[-]<<<<<<[-<<<<<+>>>>>>>>>>>+<<<<<<]>>>>>>
+[-<<<<<<+>>>>>>]>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>+>>>>>>>
+>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<
+<<<<<---------->>>>>>>>>>>>[-]+<<]>[-]<<<<<[-<<<<<+>>>>>>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<
+<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<<<<<]<[-]>[-
+]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]
+>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<<<<<---------->>>>>>>>>>>[-]+<<]>[-]<<<<[-<<<
+<<+>>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<+>>>>+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]
++>>>[-<<<->>>]<<<[[-]<<<<<<<<---------->>>>>>>>>>[-]+<<]<<<<<<<++>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]>>>>[-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<[-]>[-]>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<<<---------->>>>>>>>>[-]+<<]>>[-<<<<<<<<+>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
++<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<<<---------->>>>>>>>[-]
++<<]>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->
+-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<
+[[-]<<<<<---------->>>>>>>[-]+<<]>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<[-]>[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>
+>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<<---------->>>>>>[-]+<<]>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[-]>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<[-]>
+[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<<[-]+<[->-]>[<>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<>->]>-]<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]+>>>[-<<<->>>]<<<[[-]<<<---------->>>>>[-]+<<]>>>>-]
@@ -0,0 +1,88 @@
+// instruction counts of the dataflow pass (bf_dataflow.hpp): runs every program given, with its .in input if there is
+// one, on the runtime engine as parsed and after the pass, and reports the ops in the program, the ops executed and
+// what the pass removed or rewrote: `make bench-dataflow`, or `dataflow_ops <code file>...`
+#include "../src/bf_constexpr.hpp"
+#include "../tools/tool_io.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace bench
+{
+struct measurement
+{
+    std::string    output;
+    bf_run_summary summary;
+    std::size_t    ops        = 0;
+    std::uint64_t  dispatches = 0;
+};
+
+auto measure(const bf_program& program, const std::string& input) -> measurement
+{
+    measurement          result;
+    bf_constexpr_machine machine{program, input};
+    bf_op_counter        counter;
+    auto                 output = [&](char c) { result.output += c; };
+
+    result.summary    = machine.run(bf_options{}, output, counter);
+    result.ops        = machine.program.ops.size();
+    result.dispatches = counter.ops;
+    return result;
+}
+
+auto percent_fewer(std::uint64_t before, std::uint64_t after) -> double
+{
+    return before == 0 ? 0.0 : 100.0 * static_cast<double>(before - after) / static_cast<double>(before);
+}
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+    int status = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto input_path = std::filesystem::path{argv[i]}.replace_extension(".in");
+        const auto code       = read_file(argv[i]);
+        const auto input      = std::filesystem::exists(input_path) ? read_file(input_path) : std::string{};
+        if (!code || !input)
+        {
+            fmt::print(stderr, "can't read {}\n", !code ? argv[i] : input_path.string());
+            return 2;
+        }
+
+        // marked as optimized so the machine runs it as parsed
+        bf_program parsed{*code};
+        parsed.optimized = true;
+
+        bf_program optimized{*code};
+        const auto pass = bf_optimize(optimized);
+
+        const auto before = bench::measure(parsed, *input);
+        const auto after  = bench::measure(optimized, *input);
+        if (after.output != before.output || after.summary.status != before.summary.status ||
+            after.summary.memory_usage != before.summary.memory_usage)
+        {
+            fmt::print(stderr, "{}: different result after the dataflow pass\n", argv[i]);
+            status = 1;
+        }
+
+        fmt::print(
+            "{}: {} ops, {} after the pass ({} dead loops, {} redundant clears, {} sets); {} executed, {} after "
+            "({:.1f}% fewer)\n",
+            argv[i],
+            before.ops,
+            after.ops,
+            pass.dead_loops,
+            pass.dropped_clears,
+            pass.sets,
+            before.dispatches,
+            after.dispatches,
+            bench::percent_fewer(before.dispatches, after.dispatches));
+    }
+
+    return status;
+}
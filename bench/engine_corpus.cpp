@@ -0,0 +1,678 @@
+// cross-engine regression harness: runs every program of a corpus list on each engine the list names for it, checks
+// the output byte for byte against the program's stored expected output and measures wall time, ops/s and peak RSS of
+// every run. A compile-time engine is measured compiling a generated translation unit whose static_asserts check its
+// result, so its wall time is the compile time. With a baseline any metric worse than it by more than the threshold
+// fails the run: `make bench`, `make bench-baseline`, or
+//
+//   engine_corpus [--cxx <compile command>] [--baseline <file>] [--record <file>] [--threshold <percent>]
+//                 [--timeout <seconds>] <corpus list>
+//
+// A line of the corpus list is `<name> <code file> <input file|-> <expected output file> <engine>...`, `#` starts a
+// comment. Engines: template, template-sparse, constexpr (compiled with --cxx into gen/engine_corpus/, importing the
+// compile_time_bf module from gcm.cache/), runtime, runtime-sparse, runtime-fused, session and stream. Every run is a
+// child process of its own so its peak RSS is its own, killed after the timeout (600 s by default) and failing its
+// entry. An entry whose reference run on the runtime engine fails is failed as well, it has nothing to compare with
+#include "../src/bf_constexpr.hpp"
+#include "../src/bf_session.hpp"
+#include "../src/bf_stream.hpp"
+#include "../tools/tool_io.hpp"
+
+// generated by `make` from a profile of programs/, see tools/bf_superops.cpp
+#include "bf_superops/corpus.hpp"
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace bench
+{
+using clock = std::chrono::steady_clock;
+
+constexpr std::string_view compile_time_engines[] = {"template", "template-sparse", "constexpr"};
+constexpr std::string_view run_time_engines[]     = {"runtime", "runtime-sparse", "runtime-fused", "session", "stream"};
+
+struct corpus_entry
+{
+    std::string              name;
+    std::string              code_path;
+    std::string              input_path;
+    std::string              expected_path;
+    std::string              code;
+    std::string              input;
+    std::string              expected;
+    std::vector<std::string> engines;
+    std::uint64_t            ops          = 0; // executed on the runtime engine, the unit of every engine's ops/s
+    std::size_t              memory_usage = 0; // every engine has to report the same span
+};
+
+struct metrics
+{
+    double wall_ms    = 0;
+    double ops_per_s  = 0;
+    long   peak_rss_k = 0;
+};
+
+// what a child running an engine reports back through a pipe
+struct run_report
+{
+    bf_status   status       = bf_status::ok;
+    std::size_t memory_usage = 0;
+    std::size_t mismatch     = 0; // offset of the first byte differing from the expected output, npos if none
+    double      seconds      = 0; // of the fastest run
+};
+
+auto is_compile_time(std::string_view engine) -> bool
+{
+    return std::find(std::begin(compile_time_engines), std::end(compile_time_engines), engine) !=
+           std::end(compile_time_engines);
+}
+
+auto is_engine(std::string_view engine) -> bool
+{
+    return is_compile_time(engine) ||
+           std::find(std::begin(run_time_engines), std::end(run_time_engines), engine) != std::end(run_time_engines);
+}
+
+auto read_corpus(const std::string& path, std::vector<corpus_entry>& corpus) -> bool
+{
+    const auto list = read_file(path);
+    if (!list)
+    {
+        fmt::print(stderr, "engine_corpus: can't read {}\n", path);
+        return false;
+    }
+
+    std::istringstream lines{*list};
+    std::string        line;
+    for (std::size_t number = 1; std::getline(lines, line); ++number)
+    {
+        std::istringstream fields{line.substr(0, line.find('#'))};
+        corpus_entry       entry;
+        if (!(fields >> entry.name))
+        {
+            continue;
+        }
+
+        fields >> entry.code_path >> entry.input_path >> entry.expected_path;
+        for (std::string engine; fields >> engine;)
+        {
+            entry.engines.push_back(engine);
+        }
+
+        const bool known = std::all_of(entry.engines.begin(), entry.engines.end(), is_engine);
+        if (entry.expected_path.empty() || entry.engines.empty() || !known)
+        {
+            fmt::print(
+                stderr,
+                "{}:{}: expected `<name> <code file> <input file|-> <expected output file> <engine>...` with engines "
+                "from: {}, {}\n",
+                path,
+                number,
+                fmt::join(compile_time_engines, ", "),
+                fmt::join(run_time_engines, ", "));
+            return false;
+        }
+
+        const auto code     = read_file(entry.code_path);
+        const auto input    = entry.input_path == "-" ? std::string{} : read_file(entry.input_path);
+        const auto expected = read_file(entry.expected_path);
+        if (!code || !input || !expected)
+        {
+            fmt::print(
+                stderr,
+                "{}:{}: can't read {}\n",
+                path,
+                number,
+                !code ? entry.code_path : (!input ? entry.input_path : entry.expected_path));
+            return false;
+        }
+
+        entry.code     = *code;
+        entry.input    = *input;
+        entry.expected = *expected;
+        corpus.push_back(entry);
+    }
+
+    return true;
+}
+
+// the stream engine over a pair of pipes, fed and drained from the same thread as the driver
+auto run_stream(const bf_program& program, std::string_view input, std::string& output) -> bf_run_summary
+{
+    int to_session[2];
+    int from_session[2];
+    if (::pipe(to_session) != 0 || ::pipe(from_session) != 0)
+    {
+        return bf_run_summary{bf_status::io_error};
+    }
+    ::fcntl(to_session[1], F_SETFL, O_NONBLOCK);
+    ::fcntl(from_session[0], F_SETFL, O_NONBLOCK);
+
+    bf_run_summary   summary;
+    bf_stream_driver driver{program, 4096, [&](const bf_stream_session& session) {
+                                summary = session.summary;
+                            }};
+    driver.add(to_session[0], from_session[1]);
+
+    int         write_fd = to_session[1];
+    std::size_t written  = 0;
+    bool        eof      = false;
+    char        buffer[4096];
+    while (!eof)
+    {
+        if (write_fd >= 0)
+        {
+            const auto count = ::write(write_fd, input.data() + written, input.size() - written);
+            written += count > 0 ? static_cast<std::size_t>(count) : 0;
+            if (written == input.size() || (count < 0 && errno != EAGAIN))
+            {
+                ::close(write_fd);
+                write_fd = -1;
+            }
+        }
+
+        // end of file once the session finished and the driver closed its end
+        for (;;)
+        {
+            const auto count = ::read(from_session[0], buffer, sizeof(buffer));
+            if (count <= 0)
+            {
+                eof = count == 0;
+                break;
+            }
+            output.append(buffer, static_cast<std::size_t>(count));
+        }
+
+        driver.poll(driver.active() > 0 ? 1 : 0);
+    }
+
+    ::close(from_session[0]);
+    if (write_fd >= 0)
+    {
+        ::close(write_fd);
+    }
+
+    return summary;
+}
+
+template<typename Machine>
+auto run_machine(const corpus_entry& entry, std::string& output) -> bf_run_summary
+{
+    Machine machine{entry.code, entry.input};
+    auto    write = [&](char c) { output += c; };
+    return machine.run(bf_options{}, write);
+}
+
+auto run_engine(std::string_view engine, const corpus_entry& entry, std::string& output) -> bf_run_summary
+{
+    if (engine == "runtime-sparse")
+    {
+        return run_machine<bf_basic_constexpr_machine<bf_paged_tape, bf_no_superops>>(entry, output);
+    }
+    if (engine == "runtime-fused")
+    {
+        return run_machine<bf_basic_constexpr_machine<bf_vector_tape, bf_superops::corpus>>(entry, output);
+    }
+    if (engine == "session")
+    {
+        bf_session_runner runner{bf_program{entry.code}};
+        auto              session = runner.start(entry.input);
+        runner.run(session);
+        output = std::move(session.output);
+        return session.summary;
+    }
+    if (engine == "stream")
+    {
+        return run_stream(bf_program{entry.code}, entry.input, output);
+    }
+
+    return run_machine<bf_constexpr_machine>(entry, output);
+}
+
+// runs in the child: once to check, then timed at least 3 times and for at least 200 ms of running so even a short
+// program is timed over many runs. The fastest run is the one reported, the others only add the machine's noise
+auto measure_run(std::string_view engine, const corpus_entry& entry) -> run_report
+{
+    run_report  report;
+    std::string output;
+    const auto  summary = run_engine(engine, entry, output);
+    report.status       = summary.status;
+    report.memory_usage = summary.memory_usage;
+    report.mismatch     = std::string_view::npos;
+    if (output != entry.expected)
+    {
+        const auto differ = std::mismatch(output.begin(), output.end(), entry.expected.begin(), entry.expected.end());
+        report.mismatch   = static_cast<std::size_t>(differ.first - output.begin());
+    }
+
+    std::size_t     runs    = 0;
+    clock::duration running = {};
+    clock::duration fastest = clock::duration::max();
+    while (runs < 3 || running < std::chrono::milliseconds{200})
+    {
+        std::string discarded;
+        const auto  begin = clock::now();
+        run_engine(engine, entry, discarded);
+        const auto took = clock::now() - begin;
+        running += took;
+        fastest = std::min(fastest, took);
+        ++runs;
+    }
+
+    report.seconds = std::chrono::duration<double>(fastest).count();
+    return report;
+}
+
+auto compile_source(std::string_view engine, const corpus_entry& entry) -> std::string
+{
+    const auto code  = escape_literal(entry.code);
+    const auto input = escape_literal(entry.input);
+
+    std::string call;
+    std::string span;
+    if (engine == "template")
+    {
+        call = fmt::format("interpret_bf_ex(\"{}\"_static, \"{}\"_static)", code, input);
+        span = "result.second";
+    }
+    else if (engine == "template-sparse")
+    {
+        call = fmt::format("interpret_bf_sparse_ex(\"{}\"_static, \"{}\"_static)", code, input);
+        span = "result.second.span";
+    }
+    else
+    {
+        // g++ 12 loses the default `Options` of a function template imported from a module, so it is spelled out
+        call = fmt::format("interpret_bf_constexpr_ex<bf_options{{}}>(\"{}\"_static, \"{}\"_static)", code, input);
+        span = "result.second";
+    }
+
+    return fmt::format(
+        "// generated by engine_corpus from {}, {} engine\n"
+        "#include <array>\n"
+        "#include <string_view>\n"
+        "\n"
+        "import compile_time_bf;\n"
+        "\n"
+        "constexpr auto result = {};\n"
+        "static_assert(result.first.equals(\"{}\"_static), \"output differs from {}\");\n"
+        "static_assert({} == {}, \"memory usage differs from the runtime engine's\");\n",
+        entry.code_path,
+        engine,
+        call,
+        escape_literal(entry.expected),
+        entry.expected_path,
+        span,
+        entry.memory_usage);
+}
+
+// how a child for one run ended, `status` is its exit status or -1 if it didn't exit
+struct child_result
+{
+    int  status     = -1;
+    long peak_rss_k = 0;
+    bool timed_out  = false;
+};
+
+// a child for one run, `body` runs in it and returns its exit status. A child still running after `timeout` is killed
+// along with everything it started, a compiler driver's cc1plus as well, they share a process group of their own
+template<typename Body>
+auto in_child(std::chrono::seconds timeout, Body body) -> child_result
+{
+    std::fflush(stdout);
+    std::fflush(stderr);
+
+    const auto child = ::fork();
+    if (child == 0)
+    {
+        ::setpgid(0, 0);
+        ::_exit(body());
+    }
+    if (child < 0)
+    {
+        return {};
+    }
+    ::setpgid(child, child);
+
+    child_result result;
+    int          status   = 0;
+    rusage       usage    = {};
+    const auto   deadline = clock::now() + timeout;
+    auto         waited   = ::wait4(child, &status, WNOHANG, &usage);
+    for (; waited == 0; waited = ::wait4(child, &status, WNOHANG, &usage))
+    {
+        if (clock::now() >= deadline)
+        {
+            ::kill(-child, SIGKILL);
+            result.timed_out = true;
+            waited           = ::wait4(child, &status, 0, &usage);
+            break;
+        }
+        ::usleep(10000);
+    }
+    if (waited != child)
+    {
+        return result;
+    }
+
+    result.status     = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    result.peak_rss_k = usage.ru_maxrss;
+    return result;
+}
+
+// the metrics of one run, nothing if the engine got the program wrong
+auto measure(std::string_view engine, const corpus_entry& entry, const std::string& cxx, std::chrono::seconds timeout)
+    -> std::optional<metrics>
+{
+    metrics result;
+    if (is_compile_time(engine))
+    {
+        // the diagnostics of a failed static_assert spell out the whole program, they go to a log next to the source
+        const auto path = std::filesystem::path{"gen/engine_corpus"} / fmt::format("{}_{}.cpp", entry.name, engine);
+        const auto log  = std::filesystem::path{path}.replace_extension(".log");
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream{path} << compile_source(engine, entry);
+
+        const auto command = fmt::format("exec {} -fsyntax-only {} 2> {}", cxx, path.string(), log.string());
+        const auto begin   = clock::now();
+        const auto child   = in_child(timeout, [&] {
+            ::execl("/bin/sh", "sh", "-c", command.c_str(), nullptr);
+            return 127;
+        });
+        result.wall_ms     = std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+        result.peak_rss_k  = child.peak_rss_k;
+        if (child.timed_out)
+        {
+            fmt::print(
+                stderr,
+                "{} on the {} engine: compiling {} took longer than {} s\n",
+                entry.name,
+                engine,
+                path.string(),
+                timeout.count());
+            return std::nullopt;
+        }
+        if (child.status != 0)
+        {
+            fmt::print(
+                stderr,
+                "{} on the {} engine: compiling {} failed, see {}\n",
+                entry.name,
+                engine,
+                path.string(),
+                log.string());
+            return std::nullopt;
+        }
+    }
+    else
+    {
+        int channel[2];
+        if (::pipe(channel) != 0)
+        {
+            return std::nullopt;
+        }
+
+        const auto child = in_child(timeout, [&] {
+            const auto report = measure_run(engine, entry);
+            return ::write(channel[1], &report, sizeof(report)) == sizeof(report) ? 0 : 1;
+        });
+        ::close(channel[1]);
+
+        run_report report;
+        const bool reported = ::read(channel[0], &report, sizeof(report)) == sizeof(report);
+        ::close(channel[0]);
+        if (child.timed_out)
+        {
+            fmt::print(
+                stderr,
+                "{} on the {} engine: the run took longer than {} s\n",
+                entry.name,
+                engine,
+                timeout.count());
+            return std::nullopt;
+        }
+        if (child.status != 0 || !reported)
+        {
+            fmt::print(stderr, "{} on the {} engine: the run didn't finish\n", entry.name, engine);
+            return std::nullopt;
+        }
+
+        result.wall_ms    = report.seconds * 1000;
+        result.peak_rss_k = child.peak_rss_k;
+        if (report.status != bf_status::ok)
+        {
+            fmt::print(stderr, "{} on the {} engine: {}\n", entry.name, engine, bf_status_message(report.status));
+            return std::nullopt;
+        }
+        if (report.mismatch != std::string_view::npos)
+        {
+            fmt::print(
+                stderr,
+                "{} on the {} engine: output differs from {} at byte {}\n",
+                entry.name,
+                engine,
+                entry.expected_path,
+                report.mismatch);
+            return std::nullopt;
+        }
+        if (report.memory_usage != entry.memory_usage)
+        {
+            fmt::print(
+                stderr,
+                "{} on the {} engine: {} bytes of memory instead of the runtime engine's {}\n",
+                entry.name,
+                engine,
+                report.memory_usage,
+                entry.memory_usage);
+            return std::nullopt;
+        }
+    }
+
+    result.ops_per_s = static_cast<double>(entry.ops) / (result.wall_ms / 1000);
+    return result;
+}
+
+using results = std::map<std::pair<std::string, std::string>, metrics>;
+
+// `<name> <engine> <wall ms> <ops/s> <peak RSS KiB>` per line
+auto read_results(const std::string& path) -> std::optional<results>
+{
+    const auto content = read_file(path);
+    if (!content)
+    {
+        return std::nullopt;
+    }
+
+    results            stored;
+    std::istringstream lines{*content};
+    std::string        name;
+    std::string        engine;
+    metrics            m;
+    while (lines >> name >> engine >> m.wall_ms >> m.ops_per_s >> m.peak_rss_k)
+    {
+        stored[{name, engine}] = m;
+    }
+
+    return stored;
+}
+
+auto write_results(const std::string& path, const results& measured) -> void
+{
+    std::string content;
+    for (const auto& [key, m] : measured)
+    {
+        content += fmt::format("{} {} {:.6f} {:.0f} {}\n", key.first, key.second, m.wall_ms, m.ops_per_s, m.peak_rss_k);
+    }
+
+    std::ofstream{path} << content;
+}
+
+// the metrics worse than the baseline by more than `threshold` percent, as a description each
+auto regressions(const metrics& now, const metrics& base, double threshold) -> std::vector<std::string>
+{
+    const auto                factor = 1 + threshold / 100;
+    std::vector<std::string> found;
+    if (now.wall_ms > base.wall_ms * factor)
+    {
+        found.push_back(fmt::format("wall time {:.3f} ms, baseline {:.3f} ms", now.wall_ms, base.wall_ms));
+    }
+    if (now.ops_per_s < base.ops_per_s / factor)
+    {
+        found.push_back(fmt::format("{:.0f} ops/s, baseline {:.0f} ops/s", now.ops_per_s, base.ops_per_s));
+    }
+    if (static_cast<double>(now.peak_rss_k) > static_cast<double>(base.peak_rss_k) * factor)
+    {
+        found.push_back(fmt::format("peak RSS {} KiB, baseline {} KiB", now.peak_rss_k, base.peak_rss_k));
+    }
+
+    return found;
+}
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+    std::string cxx = "g++ -std=c++20 -Isrc -Igen -ftemplate-depth=32768";
+    std::string baseline_path;
+    std::string record_path;
+    double      threshold = 20;
+    auto        timeout   = std::chrono::seconds{600};
+
+    int arg = 1;
+    for (; arg + 1 < argc && std::string_view{argv[arg]}.starts_with("--"); arg += 2)
+    {
+        const std::string_view option = argv[arg];
+        if (option == "--cxx")
+        {
+            cxx = argv[arg + 1];
+        }
+        else if (option == "--baseline")
+        {
+            baseline_path = argv[arg + 1];
+        }
+        else if (option == "--record")
+        {
+            record_path = argv[arg + 1];
+        }
+        else if (option == "--threshold")
+        {
+            threshold = std::stod(argv[arg + 1]);
+        }
+        else if (option == "--timeout")
+        {
+            timeout = std::chrono::seconds{std::stoll(argv[arg + 1])};
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (arg + 1 != argc)
+    {
+        fmt::print(
+            stderr,
+            "usage: {} [--cxx <compile command>] [--baseline <file>] [--record <file>] [--threshold <percent>] "
+            "[--timeout <seconds>] <corpus list>\n",
+            argv[0]);
+        return 2;
+    }
+
+    std::vector<bench::corpus_entry> corpus;
+    if (!bench::read_corpus(argv[arg], corpus))
+    {
+        return 2;
+    }
+
+    const auto baseline = baseline_path.empty() ? std::nullopt : bench::read_results(baseline_path);
+    if (!baseline_path.empty() && !baseline)
+    {
+        fmt::print("no baseline at {}, `make bench-baseline` records one, nothing is compared\n", baseline_path);
+    }
+
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int            status = 0;
+    bench::results measured;
+    fmt::print("{:<12} {:<16} {:>12} {:>14} {:>12}\n", "program", "engine", "wall ms", "kops/s", "peak RSS KiB");
+    for (auto& entry : corpus)
+    {
+        // the reference the engines are held to, besides the stored output: the runtime engine's op count and span
+        bf_constexpr_machine machine{entry.code, entry.input};
+        bf_op_counter        counter;
+        auto                 discard = [](char) {};
+        const auto           summary = machine.run(bf_options{}, discard, counter);
+        entry.ops                    = counter.ops;
+        entry.memory_usage           = summary.memory_usage;
+        if (summary.status != bf_status::ok)
+        {
+            fmt::print(
+                stderr,
+                "{} on the runtime engine, the reference run: {} at code offsets [{}, {})\n",
+                entry.name,
+                bf_status_message(summary.status),
+                summary.error_begin,
+                summary.error_end);
+            status = 1;
+            continue;
+        }
+
+        for (const auto& engine : entry.engines)
+        {
+            const auto m = bench::measure(engine, entry, cxx, timeout);
+            if (!m)
+            {
+                status = 1;
+                continue;
+            }
+
+            measured[{entry.name, engine}] = *m;
+            fmt::print(
+                "{:<12} {:<16} {:>12.3f} {:>14.3f} {:>12}\n",
+                entry.name,
+                engine,
+                m->wall_ms,
+                m->ops_per_s / 1e3,
+                m->peak_rss_k);
+
+            const auto base = baseline ? baseline->find({entry.name, engine}) : bench::results::const_iterator{};
+            if (!baseline || base == baseline->end())
+            {
+                continue;
+            }
+
+            for (const auto& regression : bench::regressions(*m, base->second, threshold))
+            {
+                fmt::print(stderr, "{} on the {} engine regressed: {}\n", entry.name, engine, regression);
+                status = 1;
+            }
+        }
+    }
+
+    if (!record_path.empty())
+    {
+        bench::write_results(record_path, measured);
+        fmt::print("recorded {} runs to {}\n", measured.size(), record_path);
+    }
+
+    return status;
+}
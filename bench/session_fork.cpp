@@ -0,0 +1,142 @@
+// runtime benchmark of forking sessions from one warmed state: a program spends its setup phase filling a large part
+// of the tape and then echoes its input. The setup runs once, every session is a fork of the warmed state with its own
+// input. Reports the fork latency and the memory per session against copying a plain tape, the way a session would be
+// cloned without copy-on-write pages: `make bench-sessions`, or `session_fork [sessions] [setup pages]`
+#include "../src/bf_session.hpp"
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace bench
+{
+using clock = std::chrono::steady_clock;
+
+// each block walks a counter from 255 down to 0 over the next 255 cells, leaving a non-zero trail behind. The echo at
+// the end reads until a 0xFF byte
+auto setup_and_echo(std::size_t blocks) -> std::string
+{
+    std::string code;
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+        code += "-[[->+<]+>-]>";
+    }
+
+    return code + ",+[-.,+]";
+}
+
+auto nanoseconds_per(clock::duration elapsed, std::size_t count) -> double
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+           static_cast<double>(count);
+}
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+    const std::size_t sessions    = argc > 1 ? std::stoull(argv[1]) : 10000;
+    const std::size_t setup_pages = argc > 2 ? std::stoull(argv[2]) : 64;
+    const std::size_t blocks      = setup_pages * bf_cow_tape::page_size / 256;
+
+    const bf_program  program{bench::setup_and_echo(blocks)};
+    bf_session_runner runner{program};
+
+    const auto warm_begin = bench::clock::now();
+    auto       warm       = runner.start({});
+    runner.run(warm);
+    const auto warm_time = bench::clock::now() - warm_begin;
+
+    if (!runner.waiting_for_input(warm))
+    {
+        fmt::print(stderr, "setup didn't stop at the first input\n");
+        return 1;
+    }
+
+    std::vector<std::string> inputs;
+    for (std::size_t i = 0; i < sessions; ++i)
+    {
+        inputs.push_back(fmt::format("session {}\xff", i));
+    }
+
+    // baseline, the same warmed state with one contiguous tape copied per session
+    bf_constexpr_state plain;
+    plain.tape.resize(warm.state.tape.size());
+    for (std::size_t i = 0; i < warm.state.tape.size(); ++i)
+    {
+        plain.tape.set(i, warm.state.tape.get(i));
+    }
+
+    std::vector<bf_constexpr_state> copies;
+    copies.reserve(sessions);
+    const auto copy_begin = bench::clock::now();
+    for (std::size_t i = 0; i < sessions; ++i)
+    {
+        copies.push_back(plain);
+    }
+    const auto copy_time = bench::clock::now() - copy_begin;
+    copies.clear();
+    copies.shrink_to_fit();
+
+    std::vector<bf_session> forks;
+    forks.reserve(sessions);
+    const auto fork_begin = bench::clock::now();
+    for (std::size_t i = 0; i < sessions; ++i)
+    {
+        forks.push_back(warm.fork(inputs[i]));
+    }
+    const auto fork_time = bench::clock::now() - fork_begin;
+
+    const auto  run_begin = bench::clock::now();
+    std::size_t wrong     = 0;
+    for (std::size_t i = 0; i < sessions; ++i)
+    {
+        runner.run(forks[i]);
+
+        const auto expected = std::string_view{inputs[i]}.substr(0, inputs[i].size() - 1);
+        wrong += forks[i].summary.status != bf_status::ok || forks[i].output != expected;
+    }
+    const auto run_time = bench::clock::now() - run_begin;
+
+    // every page any session can reach counted once, plus every session's own page table
+    std::unordered_set<const bf_cow_tape::page*> distinct;
+    std::size_t                                  page_tables = 0;
+    for (const auto& session : forks)
+    {
+        for (const auto& page : session.state.tape.pages)
+        {
+            distinct.insert(page.get());
+        }
+        page_tables += session.state.tape.pages.size() * sizeof(session.state.tape.pages[0]);
+    }
+    distinct.erase(nullptr);
+
+    const auto shared_bytes = distinct.size() * bf_cow_tape::page_size + page_tables;
+    const auto plain_bytes  = sessions * plain.tape.size();
+
+    fmt::print(
+        "warm-up: {} cells written in {:.1f} ms, {} ops in the program\n",
+        warm.state.tape.size(),
+        bench::nanoseconds_per(warm_time, 1) / 1e6,
+        program.ops.size());
+    fmt::print(
+        "{} sessions, fork {:.0f} ns each (plain tape copy {:.0f} ns), run {:.0f} ns each\n",
+        sessions,
+        bench::nanoseconds_per(fork_time, sessions),
+        bench::nanoseconds_per(copy_time, sessions),
+        bench::nanoseconds_per(run_time, sessions));
+    fmt::print(
+        "tape memory per session: {:.0f} bytes with copy-on-write pages, {:.0f} bytes with plain tapes\n",
+        static_cast<double>(shared_bytes) / static_cast<double>(sessions),
+        static_cast<double>(plain_bytes) / static_cast<double>(sessions));
+
+    if (wrong > 0)
+    {
+        fmt::print(stderr, "{} sessions produced wrong output\n", wrong);
+        return 1;
+    }
+}
@@ -0,0 +1,19 @@
+// compile-time benchmark of the sparse memory on the template engine: a program parking a counter 300 cells to the
+// right of where it starts, every write there copies a string of 300 cells on `bf_memory` and a page on
+// `bf_paged_memory`. `make bench-sparse-tape` compiles it both ways and reports the times
+#include "../src/bf_interpreter.hpp"
+#include "../src/bf_preprocess.hpp"
+#include "../src/type_helpers.hpp"
+
+namespace bench
+{
+constexpr auto excursion = preprocess_bf("+ {>}*300 {+}*65 . {<}*300 ."_static);
+
+#ifdef BENCH_SPARSE
+constexpr auto result = interpret_bf_sparse(excursion, ""_static);
+#else
+constexpr auto result = interpret_bf(excursion, ""_static);
+#endif
+
+static_assert(result.equals("A\x01"_static));
+} // namespace bench
@@ -0,0 +1,63 @@
+// compile-time benchmark of the basic_static_string search helpers on a 10 KB haystack, what's measured is how long
+// the compiler takes for this translation unit: `make bench-static-string`
+#include "../src/type_helpers.hpp"
+
+#include <cstdint>
+
+namespace bench
+{
+constexpr std::size_t haystack_size = 10 * 1024;
+constexpr std::size_t note_interval = 256;
+
+// pseudo random brainfuck-ish text with "@note@" planted every `note_interval` characters and "@end@" at the end
+constexpr auto haystack_data = [] {
+    constexpr std::string_view alphabet = "+-<>.,[] abcdefghijklmnopqrstuvwxyz\n";
+    constexpr std::string_view note     = "@note@";
+    constexpr std::string_view end      = "@end@";
+
+    std::array<char, haystack_size> data{};
+    std::uint32_t                   state = 12345;
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        state   = state * 1664525u + 1013904223u;
+        data[i] = alphabet[(state >> 16) % alphabet.size()];
+    }
+
+    for (std::size_t i = note_interval; i + note.size() < data.size() - end.size(); i += note_interval)
+    {
+        for (std::size_t j = 0; j < note.size(); ++j)
+        {
+            data[i + j] = note[j];
+        }
+    }
+
+    for (std::size_t j = 0; j < end.size(); ++j)
+    {
+        data[data.size() - end.size() + j] = end[j];
+    }
+
+    return data;
+}();
+
+constexpr std::size_t note_count = haystack_size / note_interval - 1;
+
+using haystack = static_string_from_array<haystack_data>::type;
+using note     = decltype("@note@"_static)::PType;
+using end      = decltype("@end@"_static)::PType;
+using comment  = decltype("//"_static)::PType;
+
+static_assert(haystack::size == haystack_size);
+static_assert(haystack::find<note> == note_interval);
+static_assert(haystack::find<end> == haystack_size - end::size);
+static_assert(haystack::contains<end>);
+static_assert(!haystack::contains<comment>);
+static_assert(haystack::count_of<'@'> == 2 * note_count + 2);
+
+using replaced = haystack::find_and_replace_all<note, comment>;
+
+static_assert(replaced::size == haystack_size - note_count * (note::size - comment::size));
+static_assert(!replaced::contains<note>);
+static_assert(replaced::ends_with<end>);
+} // namespace bench
+
+int main() {}
@@ -0,0 +1,280 @@
+// runtime benchmark of the streaming engine: one driver thread runs rot13 sessions over pipe pairs while a load
+// generator keeps `concurrency` sessions in flight, each writing `payload` bytes of letters and reading back their
+// rot13. Reports sessions/s and the p50/p99 latency from the first byte written to the last byte read:
+// `make bench-streams`, or `stream_sessions [sessions] [concurrency] [payload bytes]`. First one session is run
+// request/response over a socket pair, a letter at a time and each sent only once the reply to the last one arrived,
+// which fails if the driver holds back output while its session waits for input
+#include "../src/bf_stream.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace bench
+{
+// programs/rot13.bf, reading until a 0xFF byte
+constexpr std::string_view rot13 =
+    "-,+[-[>>++++[>++++++++<-]<+<-[>+>+>-[>>>]<[[>+<-]>>+>]<<<<<-]]>>>[-]+>--[-[<->+++[-]]]<[++++++++++++<[>-[>+>>]>"
+    "[+[<+>-]>+>>]<<<<<-]>>[<+>-]>[-[-<<[-]>>]<<[<<->>-]>>]<<[<<+>>-]]<[-]<.[-]<-,+]";
+
+using clock = std::chrono::steady_clock;
+
+struct client
+{
+    int               write_fd = -1; // session input
+    int               read_fd  = -1; // session output
+    std::size_t       written  = 0;
+    std::string       received;
+    clock::time_point start;
+};
+
+auto payload_for(std::size_t size, std::uint32_t seed) -> std::pair<std::string, std::string>
+{
+    std::string input;
+    std::string expected;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        seed         = seed * 1664525u + 1013904223u;
+        const auto c = static_cast<char>('a' + (seed >> 16) % 26);
+        input += c;
+        expected += static_cast<char>('a' + (c - 'a' + 13) % 26);
+    }
+    input += '\xff';
+
+    return {input, expected};
+}
+
+// one rot13 session driven a letter at a time from this thread, the letter's reply awaited for at most a second
+// before the next one is sent. Returns the mean round trip in microseconds, nothing if a reply never came
+auto round_trips(const bf_program& program, std::size_t count) -> std::optional<double>
+{
+    int ends[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, ends) != 0)
+    {
+        return std::nullopt;
+    }
+
+    bool             finished = false;
+    bf_stream_driver driver{program, 4096, [&](const bf_stream_session&) { finished = true; }};
+    driver.add(ends[1], ends[1]);
+    ::fcntl(ends[0], F_SETFL, O_NONBLOCK);
+
+    const auto begin = clock::now();
+    bool       ok    = true;
+    for (std::size_t i = 0; i < count && ok; ++i)
+    {
+        const char letter = static_cast<char>('a' + i % 26);
+        char       reply  = 0;
+        ok                = ::write(ends[0], &letter, 1) == 1;
+
+        const auto deadline = clock::now() + std::chrono::seconds{1};
+        while (ok && clock::now() < deadline)
+        {
+            driver.poll(0);
+            pollfd readable{ends[0], POLLIN, 0};
+            if (::poll(&readable, 1, 1) == 1)
+            {
+                break;
+            }
+        }
+        ok = ok && ::read(ends[0], &reply, 1) == 1 && reply == static_cast<char>('a' + (letter - 'a' + 13) % 26);
+    }
+    const auto elapsed = std::chrono::duration<double, std::micro>(clock::now() - begin).count();
+
+    // the terminator ends the program, which closes its end
+    const char end = '\xff';
+    ok             = ok && ::write(ends[0], &end, 1) == 1;
+    for (const auto deadline = clock::now() + std::chrono::seconds{1}; ok && !finished && clock::now() < deadline;)
+    {
+        driver.poll(10);
+    }
+    ::close(ends[0]);
+
+    return ok && finished ? std::optional{elapsed / static_cast<double>(count)} : std::nullopt;
+}
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+    const std::size_t sessions    = argc > 1 ? std::stoull(argv[1]) : 5000;
+    const std::size_t concurrency = argc > 2 ? std::stoull(argv[2]) : 128;
+    const std::size_t payload     = argc > 3 ? std::stoull(argv[3]) : 256;
+
+    std::signal(SIGPIPE, SIG_IGN);
+
+    const auto [input, expected] = bench::payload_for(payload, 12345);
+    const bf_program program{bench::rot13};
+
+    const auto round_trip = bench::round_trips(program, 100);
+    if (!round_trip)
+    {
+        fmt::print(stderr, "request/response session: a reply never arrived\n");
+        return 1;
+    }
+    fmt::print("request/response session: 100 round trips of one letter, {:.0f} us each\n", *round_trip);
+
+    std::size_t      failed = 0;
+    bf_stream_driver driver{program, 4096, [&](const bf_stream_session& session) {
+                                if (session.summary.status != bf_status::ok)
+                                {
+                                    ++failed;
+                                }
+                            }};
+
+    // descriptors the generator hands to the driver thread
+    std::mutex                       queue_mutex;
+    std::vector<std::pair<int, int>> queue;
+    std::atomic<bool>                done = false;
+
+    std::thread server([&] {
+        std::vector<std::pair<int, int>> added;
+        while (!done || driver.active() > 0)
+        {
+            driver.poll(10);
+            {
+                std::lock_guard lock{queue_mutex};
+                added.swap(queue);
+            }
+            for (const auto& [in_fd, out_fd] : added)
+            {
+                driver.add(in_fd, out_fd);
+            }
+            added.clear();
+        }
+    });
+
+    const int                  epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    std::vector<bench::client> clients(concurrency);
+    std::vector<double>        latencies;
+    std::size_t                started    = 0;
+    std::size_t                mismatched = 0;
+
+    // events carry the client slot, the low bit tells the write end from the read end
+    auto start_session = [&](std::size_t slot) {
+        int to_session[2];
+        int from_session[2];
+        ::pipe2(to_session, O_CLOEXEC);
+        ::pipe2(from_session, O_CLOEXEC);
+
+        auto& c = clients[slot];
+        c       = bench::client{to_session[1], from_session[0], 0, {}, bench::clock::now()};
+        ::fcntl(c.write_fd, F_SETFL, O_NONBLOCK);
+        ::fcntl(c.read_fd, F_SETFL, O_NONBLOCK);
+
+        epoll_event event{};
+        event.events   = EPOLLOUT;
+        event.data.u64 = slot * 2 + 1;
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, c.write_fd, &event);
+        event.events   = EPOLLIN;
+        event.data.u64 = slot * 2;
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, c.read_fd, &event);
+
+        {
+            std::lock_guard lock{queue_mutex};
+            queue.emplace_back(to_session[0], from_session[1]);
+        }
+        driver.notify();
+        ++started;
+    };
+
+    const auto begin = bench::clock::now();
+    for (std::size_t slot = 0; slot < concurrency && started < sessions; ++slot)
+    {
+        start_session(slot);
+    }
+
+    char buffer[4096];
+    while (latencies.size() < sessions)
+    {
+        epoll_event events[256];
+        const auto  count = ::epoll_wait(epoll_fd, events, 256, -1);
+        for (int i = 0; i < count; ++i)
+        {
+            const auto slot = static_cast<std::size_t>(events[i].data.u64 / 2);
+            auto&      c    = clients[slot];
+
+            if (events[i].data.u64 % 2 == 1)
+            {
+                const auto n = ::write(c.write_fd, input.data() + c.written, input.size() - c.written);
+                if (n > 0)
+                {
+                    c.written += static_cast<std::size_t>(n);
+                }
+                if (c.written == input.size() || (n < 0 && errno != EAGAIN))
+                {
+                    ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, c.write_fd, nullptr);
+                    ::close(c.write_fd);
+                    c.write_fd = -1;
+                }
+                continue;
+            }
+
+            ssize_t n;
+            while ((n = ::read(c.read_fd, buffer, sizeof(buffer))) > 0)
+            {
+                c.received.append(buffer, static_cast<std::size_t>(n));
+            }
+            if (n < 0)
+            {
+                continue;
+            }
+
+            // end of file, the session is finished
+            latencies.push_back(std::chrono::duration<double, std::micro>(bench::clock::now() - c.start).count());
+            mismatched += c.received != expected;
+            ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, c.read_fd, nullptr);
+            ::close(c.read_fd);
+            if (c.write_fd >= 0)
+            {
+                ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, c.write_fd, nullptr);
+                ::close(c.write_fd);
+            }
+
+            if (started < sessions)
+            {
+                start_session(slot);
+            }
+        }
+    }
+    const auto elapsed = std::chrono::duration<double>(bench::clock::now() - begin).count();
+
+    done = true;
+    driver.notify();
+    server.join();
+    ::close(epoll_fd);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) { return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]; };
+
+    fmt::print(
+        "{} sessions of {} bytes, {} concurrent: {:.0f} sessions/s, latency p50 {:.0f} us, p99 {:.0f} us\n",
+        sessions,
+        payload,
+        concurrency,
+        static_cast<double>(sessions) / elapsed,
+        percentile(0.50),
+        percentile(0.99));
+
+    if (failed > 0 || mismatched > 0)
+    {
+        fmt::print(stderr, "{} sessions failed, {} produced wrong output\n", failed, mismatched);
+        return 1;
+    }
+}
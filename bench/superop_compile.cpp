@@ -0,0 +1,23 @@
+// compile-time benchmark of superinstructions on the template engine, rot13 from main.cpp with and without the
+// generated set fused in. `make bench-superops` compiles it both ways and reports the times
+#include "../src/bf_interpreter.hpp"
+#include "../src/type_helpers.hpp"
+
+#ifdef BENCH_FUSED
+#include "bf_superops/corpus.hpp"
+#endif
+
+namespace bench
+{
+constexpr auto rot13 =
+    "-,+[-[>>++++[>++++++++<-]<+<-[>+>+>-[>>>]<[[>+<-]>>+>]<<<<<-]]>>>[-]+>--[-[<->+++[-]]]<[++++++++++++<[>-[>+>>]>"
+    "[+[<+>-]>+>>]<<<<<-]>>[<+>-]>[-[-<<[-]>>]<<[<<->>-]>>]<<[<<+>>-]]<[-]<.[-]<-,+]"_static;
+
+#ifdef BENCH_FUSED
+constexpr auto result = interpret_bf_fused<bf_superops::corpus>(rot13, "ABCxyz\xFF"_static);
+#else
+constexpr auto result = interpret_bf(rot13, "ABCxyz\xFF"_static);
+#endif
+
+static_assert(result.equals("NOPklm"_static));
+} // namespace bench
@@ -0,0 +1,99 @@
+// runtime benchmark of the generated superinstruction set: runs every program given, with its .in input if there is
+// one, on the runtime engine with and without the set and reports the dispatch counts and the throughput of each:
+// `make bench-superops`, or `superop_dispatch <code file>...`
+#include "../src/bf_constexpr.hpp"
+#include "../tools/tool_io.hpp"
+
+// generated by `make` from a profile of programs/, see tools/bf_superops.cpp
+#include "bf_superops/corpus.hpp"
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace bench
+{
+using clock = std::chrono::steady_clock;
+
+struct measurement
+{
+    std::string   output;
+    std::uint64_t dispatches = 0;
+    double        seconds    = 0; // per run
+};
+
+// repeated for at least 200 ms of running so even a short program is timed over many runs, parsing and fusing the
+// program isn't part of it
+template<typename Machine>
+auto measure(const std::string& code, const std::string& input) -> measurement
+{
+    measurement result;
+    {
+        Machine       machine{code, input};
+        bf_op_counter counter;
+        auto          output = [&](char c) { result.output += c; };
+        machine.run(bf_options{}, output, counter);
+        result.dispatches = counter.ops;
+    }
+
+    const Machine   prototype{code, input};
+    std::size_t     runs    = 0;
+    std::size_t     bytes   = 0;
+    clock::duration running = {};
+    while (running < std::chrono::milliseconds{200})
+    {
+        auto       machine = prototype;
+        auto       output  = [&](char) { ++bytes; };
+        const auto begin   = clock::now();
+        machine.run(bf_options{}, output);
+        running += clock::now() - begin;
+        ++runs;
+    }
+
+    result.seconds = std::chrono::duration<double>(running).count() / static_cast<double>(runs);
+    return result;
+}
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+    using fused_machine = bf_basic_constexpr_machine<bf_vector_tape, bf_superops::corpus>;
+
+    int status = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto input_path = std::filesystem::path{argv[i]}.replace_extension(".in");
+        const auto code       = read_file(argv[i]);
+        const auto input      = std::filesystem::exists(input_path) ? read_file(input_path) : std::string{};
+        if (!code || !input)
+        {
+            fmt::print(stderr, "superop_dispatch: can't read {}\n", argv[i]);
+            return 2;
+        }
+
+        const auto plain = bench::measure<bf_constexpr_machine>(*code, *input);
+        const auto fused = bench::measure<fused_machine>(*code, *input);
+        if (plain.output != fused.output)
+        {
+            fmt::print(stderr, "{}: different output with superinstructions\n", argv[i]);
+            status = 1;
+        }
+
+        // throughput in ops of the unfused program either way, so the two are comparable
+        fmt::print(
+            "{}: {} dispatches -> {} ({:.1f}% fewer), {:.0f} -> {:.0f} Mops/s ({:.2f}x)\n",
+            argv[i],
+            plain.dispatches,
+            fused.dispatches,
+            100.0 * static_cast<double>(plain.dispatches - fused.dispatches) / static_cast<double>(plain.dispatches),
+            static_cast<double>(plain.dispatches) / plain.seconds / 1e6,
+            static_cast<double>(plain.dispatches) / fused.seconds / 1e6,
+            plain.seconds / fused.seconds);
+    }
+
+    return status;
+}
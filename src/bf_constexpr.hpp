@@ -0,0 +1,589 @@
+#pragma once
+
+#include "bf_dataflow.hpp"
+#include "bf_program.hpp"
+#include "type_helpers.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// constexpr backend: instead of one template instantiation per executed instruction the whole program is run inside
+// a single constant evaluation over a parsed `bf_program`, only the final output becomes a `basic_static_string`
+
+struct bf_options
+{
+    // stop with a diagnostic naming the looping code instead of running until the compiler gives up. A program is
+    // deterministic so once an interpreter state (position, pointer, tape, input position) repeats it will never halt
+    bool detect_cycles = false;
+    // run on `bf_paged_tape` instead of one dense block, for programs moving far to the right of the cells they use
+    bool sparse_tape = false;
+};
+
+enum class bf_status : std::uint8_t
+{
+    ok,
+    unmatched_loop_begin,
+    unmatched_loop_end,
+    input_exhausted,
+    pointer_underflow,
+    non_terminating,
+    io_error, // only from engines reading and writing file descriptors (bf_stream.hpp)
+};
+
+constexpr auto bf_status_message(bf_status status) -> std::string_view
+{
+    switch (status)
+    {
+        case bf_status::ok:
+            return "ok";
+        case bf_status::unmatched_loop_begin:
+            return "found [ without corresponding ]";
+        case bf_status::unmatched_loop_end:
+            return "found ] without corresponding [";
+        case bf_status::input_exhausted:
+            return "tried to read more from input than was provided";
+        case bf_status::pointer_underflow:
+            return "pointer moved left of the first cell";
+        case bf_status::non_terminating:
+            return "program never terminates";
+        case bf_status::io_error:
+            return "reading input or writing output failed";
+    }
+
+    return "unknown error";
+}
+
+struct bf_run_summary
+{
+    bf_status   status          = bf_status::ok;
+    std::size_t output_size     = 0;
+    std::size_t memory_usage    = 0; // span of the tape, one past the highest cell ever written
+    std::size_t resident_memory = 0; // cells the tape actually stored
+    std::size_t error_begin     = 0; // code span [error_begin, error_end) the status refers to
+    std::size_t error_end       = 0;
+};
+
+// weight of a tape cell in the incremental tape hash, splitmix64 of the cell index
+constexpr auto bf_cell_weight(std::size_t index) -> std::uint64_t
+{
+    std::uint64_t z = static_cast<std::uint64_t>(index) + 0x9e3779b97f4a7c15ull;
+    z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// the tape policy of the machine: `size()` cells readable with `get`, writable with `set`, and `resize` to grow it with
+// zero cells, `resident()` of them actually stored. This one is a single block, `bf_paged_tape` only stores the pages
+// written to and `bf_cow_tape` (bf_session.hpp) shares pages between forked sessions
+struct bf_vector_tape
+{
+    std::vector<std::int8_t> cells = std::vector<std::int8_t>(4, 0); // same initial size as `bf_memory<>`
+
+    constexpr auto size() const -> std::size_t { return cells.size(); }
+    constexpr auto resident() const -> std::size_t { return cells.size(); }
+    constexpr auto get(std::size_t index) const -> std::int8_t { return cells[index]; }
+    constexpr auto set(std::size_t index, std::int8_t value) -> void { cells[index] = value; }
+    constexpr auto resize(std::size_t size) -> void { cells.resize(size, 0); }
+};
+
+// sparse tape policy: fixed size pages allocated on their first write, in a table sorted by page number. A page nobody
+// wrote to reads as zeros without being stored, so a pointer parked far to the right costs one page instead of every
+// cell on the way there, and unlike a page per slot of the span the table doesn't grow with the distance either
+struct bf_paged_tape
+{
+    static constexpr std::size_t page_size = 256;
+
+    struct page
+    {
+        std::size_t                          number = 0;
+        std::array<std::int8_t, page_size> cells{};
+    };
+
+    std::vector<page> pages;
+    std::size_t       cells = 4; // same initial size as `bf_vector_tape`
+    std::size_t       last  = 0; // the page written last, the next access almost always lands on it again
+
+    // index in `pages` of page `number`, or of where it would be inserted
+    constexpr auto find(std::size_t number) const -> std::size_t
+    {
+        if (last < pages.size() && pages[last].number == number)
+        {
+            return last;
+        }
+
+        std::size_t low  = 0;
+        std::size_t high = pages.size();
+        while (low < high)
+        {
+            const auto middle = low + (high - low) / 2;
+            if (pages[middle].number < number)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        return low;
+    }
+
+    constexpr auto size() const -> std::size_t { return cells; }
+    constexpr auto resident() const -> std::size_t { return pages.size() * page_size; }
+
+    constexpr auto get(std::size_t index) const -> std::int8_t
+    {
+        const auto i = find(index / page_size);
+        return i < pages.size() && pages[i].number == index / page_size ? pages[i].cells[index % page_size] : 0;
+    }
+
+    constexpr auto set(std::size_t index, std::int8_t value) -> void
+    {
+        const auto i = find(index / page_size);
+        if (i == pages.size() || pages[i].number != index / page_size)
+        {
+            pages.insert(pages.begin() + static_cast<std::ptrdiff_t>(i), page{index / page_size, {}});
+        }
+
+        last = i;
+        pages[i].cells[index % page_size] = value;
+    }
+
+    constexpr auto resize(std::size_t size) -> void { cells = size; }
+
+    // a page only one side stored has to be all zeros, the pages neither stored are never looked at
+    constexpr auto same_cells(const bf_paged_tape& other) const -> bool
+    {
+        auto zero = [](const page& p) {
+            for (const auto c : p.cells)
+            {
+                if (c != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::size_t a = 0;
+        std::size_t b = 0;
+        while (a < pages.size() || b < other.pages.size())
+        {
+            if (b == other.pages.size() || (a < pages.size() && pages[a].number < other.pages[b].number))
+            {
+                if (!zero(pages[a++]))
+                {
+                    return false;
+                }
+            }
+            else if (a == pages.size() || other.pages[b].number < pages[a].number)
+            {
+                if (!zero(other.pages[b++]))
+                {
+                    return false;
+                }
+            }
+            else if (pages[a++].cells != other.pages[b++].cells)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+template<typename Tape>
+struct bf_basic_constexpr_state
+{
+    std::size_t    pc        = 0;
+    std::ptrdiff_t ptr       = 0;
+    std::size_t    input_pos = 0;
+    std::uint64_t  tape_hash = 0; // sum of cell * bf_cell_weight(index), kept up to date on every write
+    Tape           tape;
+
+    // cheap check first, the tapes are only compared when everything else (including the hash) already matches
+    constexpr auto same_as(const bf_basic_constexpr_state& other) const -> bool
+    {
+        if (pc != other.pc || ptr != other.ptr || input_pos != other.input_pos || tape_hash != other.tape_hash)
+        {
+            return false;
+        }
+
+        // a sparse tape compares its pages rather than every cell of a span that may be mostly unstored
+        if constexpr (requires { tape.same_cells(other.tape); })
+        {
+            return tape.same_cells(other.tape);
+        }
+
+        // cells past the end of either tape are zero, the tape only grows on writes
+        const auto longest = tape.size() > other.tape.size() ? tape.size() : other.tape.size();
+        for (std::size_t i = 0; i < longest; ++i)
+        {
+            const std::int8_t a = i < tape.size() ? tape.get(i) : 0;
+            const std::int8_t b = i < other.tape.size() ? other.tape.get(i) : 0;
+            if (a != b)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+using bf_constexpr_state = bf_basic_constexpr_state<bf_vector_tape>;
+
+// receives the index of every op the machine executes. This one is what a normal run uses and compiles away entirely,
+// `bf_profiler` (bf_profiler.hpp) is the instrumented one
+struct bf_no_profiler
+{
+    constexpr auto on_op(std::size_t) -> void {}
+};
+
+// counts the ops a run executes, one per dispatch, so a fused op or a set counts once however much it does
+struct bf_op_counter
+{
+    std::uint64_t ops = 0;
+
+    constexpr auto on_op(std::size_t) -> void { ++ops; }
+};
+
+// `Tape` is the tape policy, `Superops` the superinstruction set the program is fused with (`bf_no_superops`)
+template<typename Tape, typename Superops>
+struct bf_basic_constexpr_machine
+{
+    using state_type = bf_basic_constexpr_state<Tape>;
+
+    bf_program       program;
+    std::string_view input;
+    state_type       state;
+    bf_run_summary   summary;
+
+    constexpr bf_basic_constexpr_machine(std::string_view code, std::string_view input_data)
+        : program(code), input(input_data)
+    {
+        bf_optimize(program);
+        program.fuse(Superops::set);
+        check_parse();
+    }
+
+    // for running one parsed program many times, e.g. a session per connection
+    constexpr bf_basic_constexpr_machine(const bf_program& parsed, std::string_view input_data)
+        : program(parsed), input(input_data)
+    {
+        bf_optimize(program);
+        program.fuse(Superops::set);
+        check_parse();
+    }
+
+    constexpr auto check_parse() -> void
+    {
+        if (program.status == bf_parse_status::unmatched_loop_begin)
+        {
+            fail(bf_status::unmatched_loop_begin, program.error_source, program.error_source + 1);
+        }
+        else if (program.status == bf_parse_status::unmatched_loop_end)
+        {
+            fail(bf_status::unmatched_loop_end, program.error_source, program.error_source + 1);
+        }
+    }
+
+    constexpr auto running() const -> bool
+    {
+        return summary.status == bf_status::ok && state.pc < program.ops.size();
+    }
+
+    constexpr auto fail(bf_status status, std::size_t begin, std::size_t end) -> void
+    {
+        summary.status      = status;
+        summary.error_begin = begin;
+        summary.error_end   = end;
+    }
+
+    constexpr auto cell_at(std::size_t index) -> std::int8_t
+    {
+        return index < state.tape.size() ? state.tape.get(index) : 0;
+    }
+
+    constexpr auto set_cell_at(std::size_t index, std::int8_t value) -> void
+    {
+        if (index >= state.tape.size())
+        {
+            state.tape.resize(index + 1);
+        }
+
+        state.tape_hash += (static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(state.tape.get(index))) *
+                           bf_cell_weight(index);
+        state.tape.set(index, value);
+    }
+
+    constexpr auto cell() -> std::int8_t { return cell_at(static_cast<std::size_t>(state.ptr)); }
+    constexpr auto set_cell(std::int8_t value) -> void { set_cell_at(static_cast<std::size_t>(state.ptr), value); }
+
+    // what a fused handler is made of, a run of add/move ops as one write per cell it touches and one pointer move
+    constexpr auto fused_add(std::ptrdiff_t offset, int delta) -> void
+    {
+        if (summary.status != bf_status::ok)
+        {
+            return;
+        }
+
+        if (state.ptr + offset < 0)
+        {
+            const auto& op = program.ops[state.pc];
+            fail(bf_status::pointer_underflow, op.source, op.source_end);
+            return;
+        }
+
+        const auto index = static_cast<std::size_t>(state.ptr + offset);
+        set_cell_at(index, static_cast<std::int8_t>(cell_at(index) + delta));
+    }
+
+    constexpr auto fused_move(std::ptrdiff_t offset) -> void { state.ptr += offset; }
+
+    // the next op is a `]` which will jump back, the only points where a repeated state has to show up
+    constexpr auto at_back_edge() -> bool
+    {
+        return running() && program.ops[state.pc].kind == bf_op_kind::loop_end && state.ptr >= 0 && cell() != 0;
+    }
+
+    template<typename OutputFn, typename Profiler>
+    constexpr auto step(OutputFn& output, Profiler& profiler) -> void
+    {
+        const auto& op = program.ops[state.pc];
+        profiler.on_op(state.pc);
+
+        if (op.kind != bf_op_kind::move && op.kind != bf_op_kind::fused && state.ptr < 0)
+        {
+            fail(bf_status::pointer_underflow, op.source, op.source_end);
+            return;
+        }
+
+        switch (op.kind)
+        {
+            case bf_op_kind::add:
+                set_cell(static_cast<std::int8_t>(cell() + op.arg));
+                break;
+            case bf_op_kind::move:
+                state.ptr += op.arg;
+                break;
+            case bf_op_kind::output:
+                output(static_cast<char>(cell()));
+                ++summary.output_size;
+                break;
+            case bf_op_kind::input:
+                if (state.input_pos >= input.size())
+                {
+                    fail(bf_status::input_exhausted, op.source, op.source_end);
+                    return;
+                }
+                set_cell(static_cast<std::int8_t>(input[state.input_pos++]));
+                break;
+            case bf_op_kind::loop_begin:
+                if (cell() == 0)
+                {
+                    state.pc = static_cast<std::size_t>(op.arg);
+                }
+                break;
+            case bf_op_kind::loop_end:
+                if (cell() != 0)
+                {
+                    state.pc = static_cast<std::size_t>(op.arg);
+                }
+                break;
+            case bf_op_kind::fused:
+                // checks the pointer of every cell it writes itself, a superinstruction may start left of the tape
+                Superops::run(*this, op.arg);
+                break;
+            case bf_op_kind::set:
+                // like the `[-]` it stands for, clearing a cell past the end of the tape doesn't grow it
+                if (op.arg != 0 || static_cast<std::size_t>(state.ptr) < state.tape.size())
+                {
+                    set_cell(static_cast<std::int8_t>(op.arg));
+                }
+                break;
+        }
+
+        ++state.pc;
+    }
+
+    // Brent's cycle detection sampled at taken back edges: a snapshot is saved at power of two sample counts and
+    // every later sample is compared against it, hash first. Once the program cycles with period p the snapshot
+    // lands inside the cycle after O(p) further samples, so detection costs a constant factor over the cycle itself
+    template<typename OutputFn, typename Profiler>
+    constexpr auto run_detecting_cycles(OutputFn& output, Profiler& profiler) -> void
+    {
+        state_type  saved;
+        bool        have_saved = false;
+        std::size_t power      = 1;
+        std::size_t lambda     = 0;
+
+        while (running())
+        {
+            if (at_back_edge())
+            {
+                if (have_saved && state.same_as(saved))
+                {
+                    report_cycle(saved);
+                    return;
+                }
+
+                if (!have_saved || ++lambda == power)
+                {
+                    saved      = state;
+                    have_saved = true;
+                    power *= 2;
+                    lambda = 0;
+                }
+            }
+
+            step(output, profiler);
+        }
+    }
+
+    // walk the cycle once more to find the outermost loop whose back edge it takes, that loop contains every op the
+    // cycle visits since control can only move backwards through a taken back edge
+    constexpr auto report_cycle(const state_type& repeated) -> void
+    {
+        auto outermost_begin = static_cast<std::size_t>(program.ops[state.pc].arg);
+        auto outermost_end   = state.pc;
+
+        // whatever the cycle prints is never part of a result, the program doesn't finish, and replaying it isn't
+        // part of the profile
+        auto           discard = [](char) {};
+        bf_no_profiler no_profiler;
+
+        do
+        {
+            if (at_back_edge() && static_cast<std::size_t>(program.ops[state.pc].arg) < outermost_begin)
+            {
+                outermost_begin = static_cast<std::size_t>(program.ops[state.pc].arg);
+                outermost_end   = state.pc;
+            }
+
+            step(discard, no_profiler);
+        } while (!(at_back_edge() && state.same_as(repeated)));
+
+        fail(bf_status::non_terminating, program.ops[outermost_begin].source, program.ops[outermost_end].source_end);
+    }
+
+    template<typename OutputFn, typename Profiler = bf_no_profiler>
+    constexpr auto run(const bf_options& options, OutputFn& output, Profiler&& profiler = {}) -> bf_run_summary
+    {
+        if (options.detect_cycles)
+        {
+            run_detecting_cycles(output, profiler);
+        }
+        else
+        {
+            while (running())
+            {
+                step(output, profiler);
+            }
+        }
+
+        summary.memory_usage    = state.tape.size();
+        summary.resident_memory = state.tape.resident();
+        return summary;
+    }
+};
+
+using bf_constexpr_machine = bf_basic_constexpr_machine<bf_vector_tape, bf_no_superops>;
+
+template<typename OutputFn>
+constexpr auto bf_constexpr_run(std::string_view code, std::string_view input, const bf_options& options, OutputFn output)
+    -> bf_run_summary
+{
+    if (options.sparse_tape)
+    {
+        bf_basic_constexpr_machine<bf_paged_tape, bf_no_superops> machine{code, input};
+        return machine.run(options, output);
+    }
+
+    bf_constexpr_machine machine{code, input};
+    return machine.run(options, output);
+}
+
+template<bool NonTerminating, std::size_t LoopBegin, std::size_t LoopEnd, static_string_of_concept<char> LoopCode>
+struct bf_non_terminating_loop_check : std::true_type
+{
+};
+
+// the template arguments of this specialization show up in the compiler's error, naming the offending loop
+template<std::size_t LoopBegin, std::size_t LoopEnd, static_string_of_concept<char> LoopCode>
+struct bf_non_terminating_loop_check<true, LoopBegin, LoopEnd, LoopCode> : std::false_type
+{
+    static_assert(
+        LoopBegin > LoopEnd,
+        "Brainfuck Error: program never terminates, the interpreter state repeats inside the loop LoopCode spanning "
+        "code offsets [LoopBegin, LoopEnd)");
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input   = basic_static_string<char>,
+    bf_options                     Options = bf_options{}>
+struct bf_constexpr_interpreter
+{
+    static constexpr bf_run_summary summary =
+        bf_constexpr_run(Code::to_string_view(), Input::to_string_view(), Options, [](char) {});
+
+    static_assert(summary.status != bf_status::unmatched_loop_begin, "Brainfuck Error: found [ without corresponding ]");
+    static_assert(summary.status != bf_status::unmatched_loop_end, "Brainfuck Error: found ] without corresponding [");
+    static_assert(
+        summary.status != bf_status::input_exhausted,
+        "Brainfuck Error: tried to read more from input than was provided");
+    static_assert(summary.status != bf_status::pointer_underflow, "Brainfuck Error: pointer moved left of the first cell");
+    static_assert(bf_non_terminating_loop_check<
+                  summary.status == bf_status::non_terminating,
+                  summary.error_begin,
+                  summary.error_end,
+                  typename Code::template substr<summary.error_begin, summary.error_end - summary.error_begin>>::value);
+
+    // second run to fill in the output now that its size is known, skipped if the first run failed
+    static constexpr auto output_data = [] {
+        std::array<char, (summary.status == bf_status::ok ? summary.output_size : 0)> data{};
+        if constexpr (data.size() > 0)
+        {
+            std::size_t written = 0;
+            bf_constexpr_run(Code::to_string_view(), Input::to_string_view(), Options, [&](char c) {
+                data[written++] = c;
+            });
+        }
+        return data;
+    }();
+
+    struct final_result
+    {
+        static constexpr std::size_t memory_usage    = summary.memory_usage;
+        static constexpr std::size_t resident_memory = summary.resident_memory;
+        using output                                 = static_string_from_array<output_data>::type;
+    };
+
+    using result = final_result;
+};
+
+template<
+    bf_options                     Options = bf_options{},
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter = bf_constexpr_interpreter<typename Code::PType, typename Input::PType, Options>>
+constexpr auto interpret_bf_constexpr(Code, Input) -> Interpreter::result::output::create
+{
+    return {};
+}
+
+template<
+    bf_options                     Options = bf_options{},
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter = bf_constexpr_interpreter<typename Code::PType, typename Input::PType, Options>>
+constexpr auto interpret_bf_constexpr_ex(Code, Input)
+{
+    return std::pair<typename Interpreter::result::output::create, std::size_t>{{}, Interpreter::result::memory_usage};
+}
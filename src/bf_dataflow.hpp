@@ -0,0 +1,237 @@
+#pragma once
+
+#include "bf_program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// known-cell-value dataflow pass over a parsed program, run by every engine before executing it. A single forward
+// abstract interpretation tracks which cells around the pointer have a known value: all of them at the start, since
+// the tape starts zeroed, the cell under the pointer after a loop, and whatever the ops since then wrote. With it
+//
+//   a loop entered on a cell known to be zero can never run and is removed, e.g. a leading comment loop `[ ... ]`
+//   a `[-]` of a cell known to be zero is a redundant clear and is removed
+//   any other `[-]` becomes a set op, and the adds right after it are folded into the value it sets
+//
+// nothing observable changes: no removed op could have written a cell or failed, and a set to zero doesn't grow the
+// tape, same as the `[-]` it replaces. Knowledge is dropped at every loop boundary (the body may run any number of
+// times), and an input forgets the cell it reads into
+
+struct bf_dataflow_summary
+{
+    std::size_t ops_before     = 0;
+    std::size_t ops_after      = 0;
+    std::size_t dead_loops     = 0; // loops entered on a cell known to be zero
+    std::size_t dropped_clears = 0; // `[-]` of a cell known to be zero
+    std::size_t sets           = 0; // `[-]` turned into a set op
+};
+
+struct bf_known_cell
+{
+    std::ptrdiff_t position = 0;
+    bool           known    = false;
+    std::int8_t    value    = 0;
+};
+
+struct bf_dataflow_state
+{
+    std::vector<bf_known_cell> cells;
+    bool                       rest_zero = true; // cells not in `cells` are zero, until the first loop or input
+    std::ptrdiff_t             position  = 0;    // pointer, relative to where the knowledge started
+    std::ptrdiff_t             lowest    = 0;    // lower bound of the actual pointer, an op there can't underflow if >= 0
+
+    constexpr auto find(std::ptrdiff_t at) -> bf_known_cell*
+    {
+        for (auto& cell : cells)
+        {
+            if (cell.position == at)
+            {
+                return &cell;
+            }
+        }
+
+        return nullptr;
+    }
+
+    constexpr auto current() -> bf_known_cell
+    {
+        if (const auto* cell = find(position))
+        {
+            return *cell;
+        }
+
+        return bf_known_cell{position, rest_zero, 0};
+    }
+
+    constexpr auto assign(bool known, std::int8_t value) -> void
+    {
+        if (auto* cell = find(position))
+        {
+            cell->known = known;
+            cell->value = value;
+        }
+        else
+        {
+            cells.push_back(bf_known_cell{position, known, value});
+        }
+    }
+
+    // after an op other than a move the pointer was at a cell, the op would have failed otherwise
+    constexpr auto touched() -> void { lowest = lowest > 0 ? lowest : 0; }
+
+    constexpr auto forget_all() -> void
+    {
+        cells.clear();
+        rest_zero = false;
+        lowest    = 0;
+    }
+};
+
+constexpr auto bf_is_clear_loop(const std::vector<bf_op>& ops, std::size_t begin) -> bool
+{
+    return static_cast<std::size_t>(ops[begin].arg) == begin + 2 && ops[begin + 1].kind == bf_op_kind::add &&
+           (ops[begin + 1].arg == 1 || ops[begin + 1].arg == -1);
+}
+
+constexpr auto bf_optimize(bf_program& program) -> bf_dataflow_summary
+{
+    bf_dataflow_summary summary{program.ops.size(), program.ops.size()};
+    if (program.status != bf_parse_status::ok || program.optimized)
+    {
+        return summary;
+    }
+
+    constexpr std::size_t no_set = static_cast<std::size_t>(-1);
+
+    const auto&              ops = program.ops;
+    std::vector<bf_op>       result;
+    std::vector<std::size_t> new_index(ops.size(), 0);
+    bf_dataflow_state        state;
+    std::size_t              last_set = no_set; // set op in `result` that only adds to the same cell followed so far
+
+    for (std::size_t i = 0; i < ops.size(); ++i)
+    {
+        const auto& op = ops[i];
+        new_index[i]   = result.size();
+
+        switch (op.kind)
+        {
+            case bf_op_kind::add:
+            {
+                const auto cell = state.current();
+                state.assign(cell.known, static_cast<std::int8_t>(cell.value + op.arg));
+                state.touched();
+
+                // a set to zero doesn't grow the tape where the add would have, so that one stays an add
+                if (last_set != no_set && static_cast<std::int8_t>(result[last_set].arg + op.arg) != 0)
+                {
+                    result[last_set].arg        = static_cast<std::int8_t>(result[last_set].arg + op.arg);
+                    result[last_set].source_end = op.source_end;
+                }
+                else if (!result.empty() && result.back().kind == bf_op_kind::add)
+                {
+                    // the parser only folds adjacent characters, adds apart in the source (`+ +`) or with something
+                    // removed between them are merged here
+                    result.back().arg += op.arg;
+                    result.back().source_end = op.source_end;
+                }
+                else
+                {
+                    result.push_back(op);
+                }
+                break;
+            }
+            case bf_op_kind::move:
+                state.position += op.arg;
+                state.lowest += op.arg;
+                last_set = no_set;
+
+                if (!result.empty() && result.back().kind == bf_op_kind::move)
+                {
+                    result.back().arg += op.arg;
+                    result.back().source_end = op.source_end;
+                    if (result.back().arg == 0)
+                    {
+                        result.pop_back();
+                    }
+                }
+                else
+                {
+                    result.push_back(op);
+                }
+                break;
+            case bf_op_kind::output:
+                state.touched();
+                last_set = no_set;
+                result.push_back(op);
+                break;
+            case bf_op_kind::input:
+                state.assign(false, 0);
+                state.touched();
+                last_set = no_set;
+                result.push_back(op);
+                break;
+            case bf_op_kind::loop_begin:
+            {
+                const auto end  = static_cast<std::size_t>(op.arg);
+                const auto cell = state.current();
+
+                if (cell.known && cell.value == 0 && state.lowest >= 0)
+                {
+                    ++(bf_is_clear_loop(ops, i) ? summary.dropped_clears : summary.dead_loops);
+                    i = end;
+                }
+                else if (bf_is_clear_loop(ops, i))
+                {
+                    state.assign(true, 0);
+                    state.touched();
+                    last_set = result.size();
+                    result.push_back(bf_op{bf_op_kind::set, 0, op.source, ops[end].source_end});
+                    ++summary.sets;
+                    i = end;
+                }
+                else
+                {
+                    // the body starts on a non-zero cell every time around, and nothing else is known there
+                    state.forget_all();
+                    last_set = no_set;
+                    result.push_back(op);
+                }
+                break;
+            }
+            case bf_op_kind::loop_end:
+                state.forget_all();
+                state.assign(true, 0);
+                last_set = no_set;
+                result.push_back(op);
+                break;
+            case bf_op_kind::set:
+                state.assign(true, static_cast<std::int8_t>(op.arg));
+                state.touched();
+                last_set = result.size();
+                result.push_back(op);
+                break;
+            case bf_op_kind::fused:
+                // runs before fusion, a fused program has no known cells anywhere
+                state.forget_all();
+                last_set = no_set;
+                result.push_back(op);
+                break;
+        }
+    }
+
+    for (auto& op : result)
+    {
+        if (op.kind == bf_op_kind::loop_begin || op.kind == bf_op_kind::loop_end)
+        {
+            op.arg = static_cast<int>(new_index[static_cast<std::size_t>(op.arg)]);
+        }
+    }
+
+    program.ops       = result;
+    program.optimized = true;
+
+    summary.ops_after = program.ops.size();
+    return summary;
+}
@@ -0,0 +1,754 @@
+#pragma once
+
+#include "bf_dataflow.hpp"
+#include "bf_program.hpp"
+#include "type_helpers.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// template backend: every executed instruction is one `bf_interpreter` instantiation, the interpreter state lives
+// entirely in the template arguments
+
+// the memory policy of the interpreter: `size` is the span of the tape (one past the highest cell ever written),
+// `resident` the cells actually stored, `get_value`/`cell` read a cell by template argument/in a constant evaluation
+// and `set_value` is the memory with one cell written. This one is a single dense block, every cell up to the highest
+// one written is stored, `bf_paged_memory` only stores the pages written to
+template<static_string_of_concept<int8_t> Data = basic_static_string<int8_t, 0, 0, 0, 0>>
+struct bf_memory
+{
+    using data                            = Data;
+    static constexpr std::size_t size     = Data::size;
+    static constexpr std::size_t resident = Data::size;
+
+    static constexpr auto cell(std::size_t index) -> int8_t { return index < size ? Data::to_string_view()[index] : 0; }
+
+    template<std::size_t I>
+    struct get_value_helper : std::integral_constant<int8_t, 0>
+    {
+    };
+
+    template<std::size_t I>
+        requires(I < Data::size)
+    struct get_value_helper<I> : std::integral_constant<int8_t, Data::template at<I>>
+    {
+    };
+
+    template<std::size_t I>
+    static constexpr auto get_value = get_value_helper<I>::value;
+
+    template<std::size_t I, int8_t V>
+    struct set_value_helper
+    {
+        static constexpr std::size_t size_needed   = I + 1;
+        static constexpr std::size_t growth_needed = size_needed - Data::size - 1; // minus 1 to append the new value
+        using type =
+            bf_memory<typename Data::template append<make_static_string<int8_t, growth_needed>>::template append_chars<V>>;
+    };
+
+    template<std::size_t I, int8_t V>
+        requires(I < Data::size)
+    struct set_value_helper<I, V>
+    {
+        using type = bf_memory<typename Data::template replace<I, V>>;
+    };
+
+    template<std::size_t I, int8_t V>
+    using set_value = set_value_helper<I, V>::type;
+};
+
+// sparse memory policy: the pages written to so far stored back to back in `Cells`, in the order they were first
+// written, and `Directory` holding the slot of every page number in `Cells` plus one, zero for a page nobody wrote to.
+// Such a page reads as zeros without being stored, so a program parking data far to the right pays for the pages it
+// touches instead of every cell on the way there, and a cell is found with one directory lookup whatever the number of
+// pages. The last page only grows up to the highest cell written in it, the same as `bf_memory`, so a program staying
+// within one page stores the same cells as on the dense memory. `Size` is the span the same as with `bf_memory`
+template<
+    std::size_t                           PageSize  = 16,
+    std::size_t                           Size      = 4,
+    static_string_of_concept<std::size_t> Directory = basic_static_string<std::size_t>,
+    static_string_of_concept<int8_t>      Cells     = basic_static_string<int8_t>>
+struct bf_paged_memory
+{
+    static constexpr std::size_t page_size = PageSize;
+    static constexpr std::size_t size      = Size;
+    static constexpr std::size_t resident  = Cells::size;
+    static constexpr std::size_t no_page   = static_cast<std::size_t>(-1);
+
+    // where cell `index` is stored in `Cells` or, past its end, would be once the last page grows up to it. `no_page`
+    // if its page isn't stored at all
+    static constexpr auto offset_of(std::size_t index) -> std::size_t
+    {
+        const auto page = index / PageSize;
+        const auto slot = page < Directory::size ? Directory::to_string_view()[page] : 0;
+        return slot == 0 ? no_page : (slot - 1) * PageSize + index % PageSize;
+    }
+
+    static constexpr auto cell(std::size_t index) -> int8_t
+    {
+        const auto offset = offset_of(index);
+        return offset < resident ? Cells::to_string_view()[offset] : 0;
+    }
+
+    template<std::size_t I>
+    static constexpr std::size_t cell_offset = offset_of(I);
+
+    template<std::size_t I, std::size_t Offset = cell_offset<I>>
+    struct get_value_helper : std::integral_constant<int8_t, 0>
+    {
+    };
+
+    template<std::size_t I, std::size_t Offset>
+        requires(Offset < resident)
+    struct get_value_helper<I, Offset> : std::integral_constant<int8_t, Cells::template at<Offset>>
+    {
+    };
+
+    template<std::size_t I>
+    static constexpr auto get_value = get_value_helper<I>::value;
+
+    // where `set_value` writes cell `I` and the directory after the write, a cell of a stored page changes neither
+    template<std::size_t I, std::size_t Offset>
+    struct placement
+    {
+        using directory                     = Directory;
+        static constexpr std::size_t offset = Offset;
+    };
+
+    // a cell of a page not stored yet: the last page is filled up to the page size and the new one goes after it, its
+    // slot entered in the directory, grown up to its number if need be
+    template<std::size_t I>
+    struct placement<I, no_page>
+    {
+        static constexpr std::size_t number = I / PageSize;
+        static constexpr std::size_t slot   = (resident + PageSize - 1) / PageSize + 1;
+        static constexpr std::size_t growth = number < Directory::size ? 0 : number + 1 - Directory::size;
+        static constexpr std::size_t offset = (slot - 1) * PageSize + I % PageSize;
+
+        using directory =
+            Directory::template append<make_static_string<std::size_t, growth>>::template replace<number, slot>;
+    };
+
+    template<
+        std::size_t I,
+        int8_t      V,
+        typename Placement = placement<I, cell_offset<I>>,
+        bool Stored        = (Placement::offset < resident)>
+    struct set_value_helper
+    {
+        // past the end of `Cells`, grown up to the cell the same as `bf_memory`
+        static constexpr std::size_t growth_needed = Placement::offset - resident;
+        using type                                 = bf_paged_memory<
+            PageSize,
+            (I + 1 > Size ? I + 1 : Size),
+            typename Placement::directory,
+            typename Cells::template append<make_static_string<int8_t, growth_needed>>::template append_chars<V>>;
+    };
+
+    template<std::size_t I, int8_t V, typename Placement>
+    struct set_value_helper<I, V, Placement, true>
+    {
+        using type = bf_paged_memory<
+            PageSize,
+            (I + 1 > Size ? I + 1 : Size),
+            Directory,
+            typename Cells::template replace<Placement::offset, V>>;
+    };
+
+    template<std::size_t I, int8_t V>
+    using set_value = set_value_helper<I, V>::type;
+};
+
+// memory usage of a run, the span of the tape and how much of it was stored
+struct bf_memory_usage
+{
+    std::size_t span     = 0;
+    std::size_t resident = 0;
+};
+
+// `Memory` with every cell of `Writes` (an array of `bf_cell_write`) written in order
+struct bf_cell_write
+{
+    std::size_t index = 0;
+    int8_t      value = 0;
+};
+
+template<typename Memory, auto Writes, std::size_t N = 0>
+struct bf_write_cells
+{
+    using type = typename bf_write_cells<
+        typename Memory::template set_value<Writes[N].index, Writes[N].value>,
+        Writes,
+        N + 1>::type;
+};
+
+template<typename Memory, auto Writes, std::size_t N>
+    requires(N == Writes.size())
+struct bf_write_cells<Memory, Writes, N>
+{
+    using type = Memory;
+};
+
+template<static_string_of_concept<char> Input, std::size_t I>
+struct bf_get_instruction : std::integral_constant<char, 0>
+{
+};
+
+template<static_string_of_concept<char> Code, std::size_t I>
+    requires(I < Code::size)
+struct bf_get_instruction<Code, I> : std::integral_constant<char, Code::template at<I>>
+{
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input                    = basic_static_string<char>,
+    typename Memory                                         = bf_memory<>,
+    std::size_t                           InterpretPosition = 0,
+    std::size_t                           Ptr               = 0,
+    static_string_of_concept<char>        Output            = basic_static_string<char>,
+    static_string_of_concept<std::size_t> LoopStack         = basic_static_string<std::size_t>,
+    char                                  Instruction       = bf_get_instruction<Code, InterpretPosition>::value>
+struct bf_interpreter
+{
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '\0'>
+{
+    struct final_result
+    {
+        static constexpr std::size_t memory_usage    = Memory::size;
+        static constexpr std::size_t resident_memory = Memory::resident;
+        using output                                 = Output;
+    };
+
+    using result = final_result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '+'>
+{
+    using result = bf_interpreter<
+        Code,
+        Input,
+        typename Memory::template set_value<Ptr, static_cast<int8_t>(Memory::template get_value<Ptr> + 1)>,
+        InterpretPosition + 1,
+        Ptr,
+        Output,
+        LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '-'>
+{
+    using result = bf_interpreter<
+        Code,
+        Input,
+        typename Memory::template set_value<Ptr, static_cast<int8_t>(Memory::template get_value<Ptr> - 1)>,
+        InterpretPosition + 1,
+        Ptr,
+        Output,
+        LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '>'>
+{
+    using result = bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr + 1, Output, LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '<'>
+{
+    using result = bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr - 1, Output, LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '.'>
+{
+    using result =
+        bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr, typename Output::push_back<Memory::template get_value<Ptr>>, LoopStack>::
+            result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+    requires(Input::size > 0)
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ','>
+{
+    using result = bf_interpreter<
+        Code,
+        typename Input::pop_front<>,
+        typename Memory::template set_value<Ptr, static_cast<int8_t>(Input::front)>,
+        InterpretPosition + 1,
+        Ptr,
+        Output,
+        LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+    requires(Input::size == 0)
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ','>
+{
+    static_assert(Input::size > 0, "Brainfuck Error: tried to read more from input than was provided");
+};
+
+// superinstructions: `bf_lower_code` marks every run of ops fused with a superinstruction set as
+// bf_fused_begin <run> bf_fused_end, and the whole run is one step with its effect computed in a constant evaluation
+inline constexpr char bf_fused_begin = '\x01';
+inline constexpr char bf_fused_end   = '\x02';
+
+template<static_string_of_concept<char> Code, std::size_t Begin, typename Memory, std::size_t Ptr>
+struct bf_fused_step
+{
+    static constexpr std::string_view code = Code::to_string_view().substr(Begin);
+    static constexpr std::size_t      end  = Begin + code.find(bf_fused_end);
+
+    struct effect
+    {
+        std::ptrdiff_t ptr    = 0;
+        std::ptrdiff_t lowest = 0; // lowest cell written
+    };
+
+    // a pointer moved left of the first cell wraps around in `Ptr`, the same as with `<`
+    template<typename CellFn>
+    static constexpr auto replay(CellFn cell_fn) -> effect
+    {
+        effect result{static_cast<std::ptrdiff_t>(Ptr), static_cast<std::ptrdiff_t>(Ptr)};
+        for (std::size_t i = 0; i < end - Begin; ++i)
+        {
+            switch (code[i])
+            {
+                case '+':
+                case '-':
+                    result.lowest = result.ptr < result.lowest ? result.ptr : result.lowest;
+                    if (result.ptr >= 0)
+                    {
+                        cell_fn(static_cast<std::size_t>(result.ptr), code[i] == '+' ? 1 : -1);
+                    }
+                    break;
+                case '>':
+                    ++result.ptr;
+                    break;
+                case '<':
+                    --result.ptr;
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    // every cell the run writes, in the order of their first write
+    static constexpr auto touched(std::vector<bf_cell_write>& writes) -> void
+    {
+        replay([&](std::size_t index, int delta) {
+            auto it = writes.begin();
+            while (it != writes.end() && it->index != index)
+            {
+                ++it;
+            }
+            if (it == writes.end())
+            {
+                writes.push_back({index, Memory::cell(index)});
+                it = writes.end() - 1;
+            }
+            it->value = static_cast<int8_t>(it->value + delta);
+        });
+    }
+
+    static constexpr effect summary = replay([](std::size_t, int) {});
+    static_assert(summary.lowest >= 0, "Brainfuck Error: pointer moved left of the first cell");
+
+    // one write per cell however often the run touches it, a cell whose changes cancel out is still written and grows
+    // the memory the same as the `+-` it came from
+    static constexpr auto writes = [] {
+        constexpr auto count = [] {
+            std::vector<bf_cell_write> all;
+            touched(all);
+            return all.size();
+        }();
+
+        std::array<bf_cell_write, (summary.lowest >= 0 ? count : 0)> data{};
+        if constexpr (data.size() > 0)
+        {
+            std::vector<bf_cell_write> all;
+            touched(all);
+            for (std::size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = all[i];
+            }
+        }
+        return data;
+    }();
+
+    using memory                               = bf_write_cells<Memory, writes>::type;
+    static constexpr std::size_t ptr           = static_cast<std::size_t>(summary.ptr);
+    static constexpr std::size_t next_position = end + 1;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, bf_fused_begin>
+{
+    using step = bf_fused_step<Code, InterpretPosition + 1, Memory, Ptr>;
+
+    using result =
+        bf_interpreter<Code, Input, typename step::memory, step::next_position, step::ptr, Output, LoopStack>::result;
+};
+
+// set ops of the dataflow pass (bf_dataflow.hpp): `bf_lower_code` writes one as bf_set_marker followed by its value as
+// two letters 'a' + nibble, neither of which can be a bracket the jump finder would count
+inline constexpr char bf_set_marker = '\x03';
+
+template<typename Memory, std::size_t Ptr, int8_t Value, bool Write = (Value != 0 || Ptr < Memory::size)>
+struct bf_set_cell
+{
+    // like the `[-]` the set stands for, clearing a cell past the end of the tape doesn't grow it
+    using type = Memory;
+};
+
+template<typename Memory, std::size_t Ptr, int8_t Value>
+struct bf_set_cell<Memory, Ptr, Value, true>
+{
+    using type = typename Memory::template set_value<Ptr, Value>;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, bf_set_marker>
+{
+    static constexpr auto value = static_cast<int8_t>(
+        (Code::template at<InterpretPosition + 1> - 'a') * 16 + (Code::template at<InterpretPosition + 2> - 'a'));
+
+    using result = bf_interpreter<
+        Code,
+        Input,
+        typename bf_set_cell<Memory, Ptr, value>::type,
+        InterpretPosition + 3,
+        Ptr,
+        Output,
+        LoopStack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    std::size_t                    CheckPosition,
+    std::size_t                    StackSize,
+    char                           Instruction = bf_get_instruction<Code, CheckPosition>::value>
+struct bf_get_forward_jump_helper_finder
+{
+    static_assert(Instruction != 0, "Brainfuck Error: found [ without corresponding ]");
+};
+
+template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize, char Instruction>
+    requires(Instruction != 0)
+struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, Instruction>
+    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize>
+{
+};
+
+template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize>
+struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, '['>
+    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize + 1>
+{
+};
+
+template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize>
+struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, ']'>
+    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize - 1>
+{
+};
+
+template<static_string_of_concept<char> Code, std::size_t CheckPosition>
+struct bf_get_forward_jump_helper_finder<Code, CheckPosition, 0, ']'>
+    : std::integral_constant<std::size_t, CheckPosition + 1>
+{
+};
+
+template<static_string_of_concept<char> Code, std::size_t InterpretPosition, static_string_of_concept<std::size_t> LoopStack, bool jumping>
+struct bf_get_forward_jump_helper
+{
+    using loop_stack                           = typename LoopStack::template push_back<InterpretPosition>;
+    static constexpr std::size_t next_position = InterpretPosition + 1;
+};
+
+template<static_string_of_concept<char> Code, std::size_t InterpretPosition, static_string_of_concept<std::size_t> LoopStack>
+struct bf_get_forward_jump_helper<Code, InterpretPosition, LoopStack, true>
+{
+    using loop_stack = LoopStack;
+    static constexpr std::size_t next_position = bf_get_forward_jump_helper_finder<Code, InterpretPosition + 1, 0>::value;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '['>
+{
+    static constexpr bool jump_forward = Memory::template get_value<Ptr> == 0;
+    using jump_helper                  = bf_get_forward_jump_helper<Code, InterpretPosition, LoopStack, jump_forward>;
+
+    using result =
+        bf_interpreter<Code, Input, Memory, jump_helper::next_position, Ptr, Output, typename jump_helper::loop_stack>::result;
+};
+
+template<
+    static_string_of_concept<char> Code,
+    static_string_of_concept<char> Input,
+    typename Memory,
+    std::size_t                           InterpretPosition,
+    std::size_t                           Ptr,
+    static_string_of_concept<char>        Output,
+    static_string_of_concept<std::size_t> LoopStack>
+struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ']'>
+{
+    static constexpr bool jump_back = Memory::template get_value<Ptr> != 0;
+    using result                    = bf_interpreter<
+        Code,
+        Input,
+        Memory,
+        (jump_back ? LoopStack::back : InterpretPosition + 1),
+        Ptr,
+        Output,
+        typename LoopStack::template pop_back<>>::result;
+};
+
+// `Code` as the template engine runs it: the program after the dataflow pass (bf_dataflow.hpp), fused with
+// `Superops::set` (see bf_program::fuse), written back as code without comments. A fused run is marked for
+// `bf_fused_step`, a set op for the bf_set_marker step
+template<typename Superops, typename OutputFn>
+constexpr auto bf_lower_code(std::string_view code, OutputFn output) -> std::size_t
+{
+    bf_program program{code};
+    bf_optimize(program);
+    program.fuse(Superops::set);
+
+    std::size_t size = 0;
+    auto        emit = [&](char c) {
+        output(c);
+        ++size;
+    };
+    auto emit_run = [&](int amount, char up, char down) {
+        for (int i = 0; i < (amount > 0 ? amount : -amount); ++i)
+        {
+            emit(amount > 0 ? up : down);
+        }
+    };
+
+    // a program that doesn't parse is run as it is, for the interpreter's own diagnostic
+    if (program.status != bf_parse_status::ok)
+    {
+        for (const auto c : code)
+        {
+            emit(c);
+        }
+        return size;
+    }
+
+    for (const auto& op : program.ops)
+    {
+        switch (op.kind)
+        {
+            case bf_op_kind::add:
+                if (op.arg == 0)
+                {
+                    // still a write, it has to grow the memory
+                    emit('+');
+                    emit('-');
+                }
+                emit_run(op.arg, '+', '-');
+                break;
+            case bf_op_kind::move:
+                emit_run(op.arg, '>', '<');
+                break;
+            case bf_op_kind::output:
+                emit('.');
+                break;
+            case bf_op_kind::input:
+                emit(',');
+                break;
+            case bf_op_kind::loop_begin:
+                emit('[');
+                break;
+            case bf_op_kind::loop_end:
+                emit(']');
+                break;
+            case bf_op_kind::fused:
+                emit(bf_fused_begin);
+                for (const auto c : Superops::set[static_cast<std::size_t>(op.arg)].code)
+                {
+                    emit(c);
+                }
+                emit(bf_fused_end);
+                break;
+            case bf_op_kind::set:
+            {
+                const auto value = static_cast<std::uint8_t>(op.arg);
+                emit(bf_set_marker);
+                emit(static_cast<char>('a' + value / 16));
+                emit(static_cast<char>('a' + value % 16));
+                break;
+            }
+        }
+    }
+
+    return size;
+}
+
+template<typename Superops, static_string_of_concept<char> Code>
+struct bf_lowered_code
+{
+    static constexpr auto data = [] {
+        std::array<char, bf_lower_code<Superops>(Code::to_string_view(), [](char) {})> result{};
+        std::size_t                                                                  written = 0;
+        bf_lower_code<Superops>(Code::to_string_view(), [&](char c) { result[written++] = c; });
+        return result;
+    }();
+
+    using type = static_string_from_array<data>::type;
+};
+
+template<typename CType, CType... Values>
+constexpr auto operator""_bf()
+{
+    using code = bf_lowered_code<bf_no_superops, basic_static_string<CType, Values...>>::type;
+    return typename bf_interpreter<code>::result::output::create();
+}
+
+template<
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter =
+        bf_interpreter<typename bf_lowered_code<bf_no_superops, typename Code::PType>::type, typename Input::PType>>
+constexpr auto interpret_bf(Code, Input) -> Interpreter::result::output::create
+{
+    return {};
+}
+
+template<
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter =
+        bf_interpreter<typename bf_lowered_code<bf_no_superops, typename Code::PType>::type, typename Input::PType>>
+constexpr auto interpret_bf_ex(Code, Input)
+{
+    return std::pair<typename Interpreter::result::output::create, std::size_t>{{}, Interpreter::result::memory_usage};
+}
+
+// the template engine with the runs of ops of a superinstruction set, e.g. one generated from a profile by
+// tools/bf_superops.cpp, executed as one instantiation each instead of one per character
+template<
+    typename Superops,
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter =
+        bf_interpreter<typename bf_lowered_code<Superops, typename Code::PType>::type, typename Input::PType>>
+constexpr auto interpret_bf_fused(Code, Input) -> Interpreter::result::output::create
+{
+    return {};
+}
+
+// the template engine on `bf_paged_memory`, for programs moving far to the right of the cells they use: a write only
+// instantiates the page it lands on instead of a string of every cell up to it
+template<
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter = bf_interpreter<
+        typename bf_lowered_code<bf_no_superops, typename Code::PType>::type,
+        typename Input::PType,
+        bf_paged_memory<>>>
+constexpr auto interpret_bf_sparse(Code, Input) -> Interpreter::result::output::create
+{
+    return {};
+}
+
+template<
+    static_string_creation_concept Code,
+    static_string_creation_concept Input,
+    typename Interpreter = bf_interpreter<
+        typename bf_lowered_code<bf_no_superops, typename Code::PType>::type,
+        typename Input::PType,
+        bf_paged_memory<>>>
+constexpr auto interpret_bf_sparse_ex(Code, Input)
+{
+    return std::pair<typename Interpreter::result::output::create, bf_memory_usage>{
+        {},
+        {Interpreter::result::memory_usage, Interpreter::result::resident_memory}};
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+#include "bf_program.hpp"
+#include "type_helpers.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// source front end: expands macros and repeats and drops every non-command character in a single constant
+// evaluation, so the template interpreter never spends an instantiation stepping over a comment byte.
+//
+//   #define NAME body   a line defining NAME, every later $NAME in the code is replaced with body. A body can use the
+//                       macros defined above it, so expansion always terminates
+//   {code}*N            code repeated N times, repeats nest
+//
+// every other character is a comment, plain words and braces that don't close with `}*N` included, so commented
+// sources that predate the preprocessor keep their meaning
+
+enum class bf_preprocess_status : std::uint8_t
+{
+    ok,
+    malformed_define,
+    invalid_macro_name,
+    duplicate_macro,
+    unknown_macro,
+    missing_repeat_count,
+};
+
+struct bf_preprocess_summary
+{
+    bf_preprocess_status status       = bf_preprocess_status::ok;
+    std::size_t          output_size  = 0;
+    std::size_t          error_source = 0; // offset of the offending character when status != ok
+};
+
+struct bf_macro
+{
+    std::string_view name;
+    std::size_t      body_begin = 0; // source span of the body
+    std::size_t      body_end   = 0;
+};
+
+constexpr auto bf_is_identifier_start(char c) -> bool
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+constexpr auto bf_is_identifier(char c) -> bool
+{
+    return bf_is_identifier_start(c) || (c >= '0' && c <= '9');
+}
+
+struct bf_preprocessor
+{
+    static constexpr std::string_view define_directive = "#define";
+    static constexpr char             macro_marker     = '$';
+
+    std::string_view      source;
+    std::vector<bf_macro> macros;
+    bf_preprocess_summary summary;
+
+    constexpr explicit bf_preprocessor(std::string_view code) : source(code) { collect_macros(); }
+
+    constexpr auto fail(bf_preprocess_status status, std::size_t source_offset) -> void
+    {
+        summary.status       = status;
+        summary.error_source = source_offset;
+    }
+
+    constexpr auto skip_blanks(std::size_t i, std::size_t end) const -> std::size_t
+    {
+        while (i < end && (source[i] == ' ' || source[i] == '\t'))
+        {
+            ++i;
+        }
+
+        return i;
+    }
+
+    constexpr auto identifier_end(std::size_t i, std::size_t end) const -> std::size_t
+    {
+        while (i < end && bf_is_identifier(source[i]))
+        {
+            ++i;
+        }
+
+        return i;
+    }
+
+    constexpr auto line_end(std::size_t i) const -> std::size_t
+    {
+        const auto newline = source.find('\n', i);
+        return newline == source.npos ? source.size() : newline;
+    }
+
+    // offset of the `#define` if the line starting at `i` is a directive, npos otherwise
+    constexpr auto directive_at(std::size_t i) const -> std::size_t
+    {
+        const auto start = skip_blanks(i, source.size());
+        return source.substr(start).starts_with(define_directive) ? start : source.npos;
+    }
+
+    constexpr auto find_macro(std::string_view name, std::size_t visible) const -> std::size_t
+    {
+        for (std::size_t m = 0; m < visible; ++m)
+        {
+            if (macros[m].name == name)
+            {
+                return m;
+            }
+        }
+
+        return macros.size();
+    }
+
+    constexpr auto collect_macros() -> void
+    {
+        for (std::size_t line = 0; line < source.size() && summary.status == bf_preprocess_status::ok;
+             line             = line_end(line) + 1)
+        {
+            const auto directive = directive_at(line);
+            if (directive == source.npos)
+            {
+                continue;
+            }
+
+            const auto end        = line_end(line);
+            const auto name_begin = skip_blanks(directive + define_directive.size(), end);
+            const auto name_end   = identifier_end(name_begin, end);
+
+            if (name_begin == directive + define_directive.size() || name_begin == end)
+            {
+                fail(bf_preprocess_status::malformed_define, directive);
+                return;
+            }
+
+            if (!bf_is_identifier_start(source[name_begin]) ||
+                (name_end < end && source[name_end] != ' ' && source[name_end] != '\t'))
+            {
+                fail(bf_preprocess_status::invalid_macro_name, name_begin);
+                return;
+            }
+
+            const auto name = source.substr(name_begin, name_end - name_begin);
+            if (find_macro(name, macros.size()) != macros.size())
+            {
+                fail(bf_preprocess_status::duplicate_macro, name_begin);
+                return;
+            }
+
+            macros.push_back(bf_macro{name, skip_blanks(name_end, end), end});
+        }
+    }
+
+    // offset of the `}` closing the `{` at `open` if it is followed by `*`, which makes the braces a repeat, npos if
+    // there is no such `}` before `end`
+    constexpr auto repeat_end(std::size_t open, std::size_t end) const -> std::size_t
+    {
+        std::size_t depth = 0;
+        for (std::size_t i = open; i < end; ++i)
+        {
+            if (source[i] == '{')
+            {
+                ++depth;
+            }
+            else if (source[i] == '}' && --depth == 0)
+            {
+                return i + 1 < end && source[i + 1] == '*' ? i : source.npos;
+            }
+        }
+
+        return source.npos;
+    }
+
+    // expands the source span [begin, end) where only the first `visible` macros may be used
+    template<typename OutputFn>
+    constexpr auto expand(std::size_t begin, std::size_t end, std::size_t visible, OutputFn& output) -> void
+    {
+        for (std::size_t i = begin; i < end && summary.status == bf_preprocess_status::ok;)
+        {
+            const char c = source[i];
+
+            if ((i == 0 || source[i - 1] == '\n') && directive_at(i) != source.npos)
+            {
+                // definitions were collected up front
+                i = line_end(i);
+            }
+            else if (bf_is_command(c))
+            {
+                output(c);
+                ++summary.output_size;
+                ++i;
+            }
+            else if (c == macro_marker && i + 1 < end && bf_is_identifier_start(source[i + 1]))
+            {
+                const auto word_end = identifier_end(i + 1, end);
+                const auto macro    = find_macro(source.substr(i + 1, word_end - i - 1), visible);
+                if (macro == macros.size())
+                {
+                    fail(bf_preprocess_status::unknown_macro, i);
+                    return;
+                }
+
+                expand(macros[macro].body_begin, macros[macro].body_end, macro, output);
+                i = word_end;
+            }
+            else if (const auto close = c == '{' ? repeat_end(i, end) : source.npos; close != source.npos)
+            {
+                std::size_t count_end = close + 2;
+                std::size_t count     = 0;
+                for (; count_end < end && source[count_end] >= '0' && source[count_end] <= '9'; ++count_end)
+                {
+                    count = count * 10 + static_cast<std::size_t>(source[count_end] - '0');
+                }
+
+                if (count_end == close + 2)
+                {
+                    fail(bf_preprocess_status::missing_repeat_count, close);
+                    return;
+                }
+
+                for (std::size_t n = 0; n < count && summary.status == bf_preprocess_status::ok; ++n)
+                {
+                    expand(i + 1, close, visible, output);
+                }
+                i = count_end;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    template<typename OutputFn>
+    constexpr auto run(OutputFn& output) -> bf_preprocess_summary
+    {
+        if (summary.status == bf_preprocess_status::ok)
+        {
+            expand(0, source.size(), macros.size(), output);
+        }
+
+        return summary;
+    }
+};
+
+template<typename OutputFn>
+constexpr auto bf_preprocess_run(std::string_view code, OutputFn output) -> bf_preprocess_summary
+{
+    bf_preprocessor preprocessor{code};
+    return preprocessor.run(output);
+}
+
+template<static_string_of_concept<char> Source>
+struct bf_preprocess
+{
+    static constexpr bf_preprocess_summary summary = bf_preprocess_run(Source::to_string_view(), [](char) {});
+
+    static_assert(summary.status != bf_preprocess_status::malformed_define, "Brainfuck Error: #define without a name");
+    static_assert(
+        summary.status != bf_preprocess_status::invalid_macro_name,
+        "Brainfuck Error: #define with an invalid macro name");
+    static_assert(summary.status != bf_preprocess_status::duplicate_macro, "Brainfuck Error: macro defined twice");
+    static_assert(summary.status != bf_preprocess_status::unknown_macro, "Brainfuck Error: $NAME of an undefined macro");
+    static_assert(
+        summary.status != bf_preprocess_status::missing_repeat_count,
+        "Brainfuck Error: repeat {...} not followed by *count");
+
+    // second run to fill in the code now that its size is known, skipped if the first run failed
+    static constexpr auto code_data = [] {
+        std::array<char, (summary.status == bf_preprocess_status::ok ? summary.output_size : 0)> data{};
+        if constexpr (data.size() > 0)
+        {
+            std::size_t written = 0;
+            bf_preprocess_run(Source::to_string_view(), [&](char c) { data[written++] = c; });
+        }
+        return data;
+    }();
+
+    using type = static_string_from_array<code_data>::type;
+};
+
+template<static_string_creation_of_concept<char> Source>
+constexpr auto preprocess_bf(Source) -> bf_preprocess<typename Source::PType>::type::create
+{
+    return {};
+}
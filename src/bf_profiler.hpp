@@ -0,0 +1,291 @@
+#pragma once
+
+#include "bf_program.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// instrumented counterpart of `bf_no_profiler` for the runtime engine: counts every executed op and, every
+// `sample_interval` ops, attributes the cycles elapsed since the previous sample to the op running at that moment.
+// Everything is kept per op of the parsed program and reported against the op's code offsets, the same offsets
+// `bf_get_instruction` indexes, with `[ ]` loops as the frames of a call stack
+struct bf_profiler
+{
+    static constexpr std::size_t no_loop = static_cast<std::size_t>(-1);
+
+    const bf_program*          program;
+    std::string_view           code;
+    std::vector<std::uint64_t> counts;
+    std::vector<std::uint64_t> cycles;
+    std::vector<std::size_t>   enclosing_loop; // loop_begin op of the innermost loop around each op, no_loop if none
+    std::uint64_t              sample_interval;
+    std::uint64_t              until_sample;
+    std::uint64_t              last_sample;
+
+    static auto timestamp() -> std::uint64_t
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    bf_profiler(const bf_program& parsed, std::string_view source, std::uint64_t interval = 1024)
+        : program(&parsed)
+        , code(source)
+        , counts(parsed.ops.size(), 0)
+        , cycles(parsed.ops.size(), 0)
+        , enclosing_loop(parsed.ops.size(), no_loop)
+        , sample_interval(interval)
+        , until_sample(interval)
+        , last_sample(timestamp())
+    {
+        // a `[` belongs to the code around its loop (it runs once per entry), a `]` to its own loop (once per iteration)
+        std::vector<std::size_t> open_loops;
+        for (std::size_t i = 0; i < parsed.ops.size(); ++i)
+        {
+            if (!open_loops.empty())
+            {
+                enclosing_loop[i] = open_loops.back();
+            }
+
+            if (parsed.ops[i].kind == bf_op_kind::loop_begin)
+            {
+                open_loops.push_back(i);
+            }
+            else if (parsed.ops[i].kind == bf_op_kind::loop_end)
+            {
+                open_loops.pop_back();
+            }
+        }
+    }
+
+    auto on_op(std::size_t op) -> void
+    {
+        ++counts[op];
+        if (--until_sample == 0)
+        {
+            const auto now = timestamp();
+            cycles[op] += now - last_sample;
+            last_sample  = now;
+            until_sample = sample_interval;
+        }
+    }
+
+    // sampled cycles when there are any, a run shorter than one interval only has execution counts
+    auto weights() const -> const std::vector<std::uint64_t>&
+    {
+        return std::any_of(cycles.begin(), cycles.end(), [](auto c) { return c > 0; }) ? cycles : counts;
+    }
+
+    // `+3`, `<2`, `[-]+65`: the code an op was made from can span comments and, once the dataflow pass merged ops,
+    // whatever it removed in between, none of which may end up in a frame name
+    static auto spelling_of(const bf_op& op) -> std::string
+    {
+        auto amount = [&](char up, char down) {
+            return fmt::format("{}{}", op.arg < 0 ? down : up, op.arg < 0 ? -op.arg : op.arg);
+        };
+
+        switch (op.kind)
+        {
+            case bf_op_kind::add:
+                return amount('+', '-');
+            case bf_op_kind::move:
+                return amount('>', '<');
+            case bf_op_kind::output:
+                return ".";
+            case bf_op_kind::input:
+                return ",";
+            case bf_op_kind::loop_begin:
+                return "[";
+            case bf_op_kind::loop_end:
+                return "]";
+            case bf_op_kind::set:
+                return op.arg == 0 ? "[-]" : "[-]" + amount('+', '-');
+            case bf_op_kind::fused:
+                return fmt::format("fused{}", op.arg);
+        }
+
+        return {};
+    }
+
+    auto loop_frame(std::size_t begin) const -> std::string
+    {
+        const auto& end = program->ops[static_cast<std::size_t>(program->ops[begin].arg)];
+        return fmt::format("loop@{}-{}", program->ops[begin].source, end.source_end);
+    }
+
+    // one line per op, `loop@12-40;loop@20-31;+3@22 <weight>`, for flamegraph.pl, speedscope and friends
+    auto write_collapsed(std::FILE* file) const -> void
+    {
+        const auto& weight = weights();
+        for (std::size_t op = 0; op < weight.size(); ++op)
+        {
+            if (weight[op] == 0)
+            {
+                continue;
+            }
+
+            std::string stack;
+            for (auto loop = enclosing_loop[op]; loop != no_loop; loop = enclosing_loop[loop])
+            {
+                stack.insert(0, loop_frame(loop) + ";");
+            }
+
+            fmt::print(
+                file,
+                "{}{}@{} {}\n",
+                stack,
+                spelling_of(program->ops[op]),
+                program->ops[op].source,
+                weight[op]);
+        }
+    }
+
+    struct loop_stats
+    {
+        std::size_t   begin      = 0; // loop_begin op
+        std::uint64_t entered    = 0;
+        std::uint64_t iterations = 0;
+        std::uint64_t ops        = 0; // executed ops inside the loop including nested loops
+        std::uint64_t cycles     = 0;
+    };
+
+    auto loops() const -> std::vector<loop_stats>
+    {
+        std::vector<loop_stats>  result;
+        std::vector<std::size_t> slot(program->ops.size(), no_loop);
+        for (std::size_t op = 0; op < program->ops.size(); ++op)
+        {
+            if (program->ops[op].kind == bf_op_kind::loop_begin)
+            {
+                slot[op] = result.size();
+                result.push_back(loop_stats{op, counts[op]});
+            }
+        }
+
+        for (std::size_t op = 0; op < program->ops.size(); ++op)
+        {
+            if (program->ops[op].kind == bf_op_kind::loop_end)
+            {
+                result[slot[static_cast<std::size_t>(program->ops[op].arg)]].iterations += counts[op];
+            }
+
+            for (auto loop = enclosing_loop[op]; loop != no_loop; loop = enclosing_loop[loop])
+            {
+                result[slot[loop]].ops += counts[op];
+                result[slot[loop]].cycles += cycles[op];
+            }
+        }
+
+        return result;
+    }
+
+    struct sequence_stats
+    {
+        std::string   code;         // canonical spelling, what a `bf_superop` for the sequence is given as
+        std::size_t   length   = 0; // ops
+        std::uint64_t executed = 0;
+        std::uint64_t saved    = 0; // dispatches a superinstruction for it would save, length - 1 per execution
+    };
+
+    // every run of 2 to `max_length` consecutive add/move ops, merged by spelling. Nothing jumps into the middle of
+    // such a run, so all of its ops execute as often as the first. Ops adding or moving by 0 or by more than `max_arg`
+    // are never part of one
+    auto op_sequences(std::size_t max_length, int max_arg = 16) const -> std::vector<sequence_stats>
+    {
+        const auto& ops     = program->ops;
+        auto        fusable = [&](const bf_op& op) {
+            return (op.kind == bf_op_kind::add || op.kind == bf_op_kind::move) && op.arg != 0 && op.arg >= -max_arg &&
+                   op.arg <= max_arg;
+        };
+        auto spelling = [](const bf_op& op) {
+            const char c = op.kind == bf_op_kind::add ? (op.arg > 0 ? '+' : '-') : (op.arg > 0 ? '>' : '<');
+            return std::string(static_cast<std::size_t>(op.arg > 0 ? op.arg : -op.arg), c);
+        };
+
+        std::vector<sequence_stats> result;
+        for (std::size_t begin = 0; begin < ops.size(); ++begin)
+        {
+            if (counts[begin] == 0 || !fusable(ops[begin]))
+            {
+                continue;
+            }
+
+            auto code = spelling(ops[begin]);
+            for (std::size_t end = begin + 1; end < ops.size() && end - begin < max_length && fusable(ops[end]); ++end)
+            {
+                code += spelling(ops[end]);
+
+                const auto length = end - begin + 1;
+                auto found = std::find_if(result.begin(), result.end(), [&](const auto& s) { return s.code == code; });
+                if (found == result.end())
+                {
+                    found = result.insert(result.end(), sequence_stats{code, length});
+                }
+                found->executed += counts[begin];
+                found->saved += counts[begin] * (length - 1);
+            }
+        }
+
+        std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+            return a.saved != b.saved ? a.saved > b.saved : a.code < b.code;
+        });
+        return result;
+    }
+
+    auto write_hot_loops(std::FILE* file, std::size_t top) const -> void
+    {
+        auto stats = loops();
+        std::sort(stats.begin(), stats.end(), [](const auto& a, const auto& b) {
+            return a.cycles != b.cycles ? a.cycles > b.cycles : a.ops > b.ops;
+        });
+
+        std::uint64_t total_ops    = 0;
+        std::uint64_t total_cycles = 0;
+        for (std::size_t op = 0; op < counts.size(); ++op)
+        {
+            total_ops += counts[op];
+            total_cycles += cycles[op];
+        }
+
+        auto percent = [](std::uint64_t part, std::uint64_t whole) {
+            return whole == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(whole);
+        };
+
+        fmt::print(file, "{} ops executed, {} cycles sampled\n", total_ops, total_cycles);
+        for (std::size_t i = 0; i < stats.size() && i < top; ++i)
+        {
+            const auto& loop  = stats[i];
+            const auto& end   = program->ops[static_cast<std::size_t>(program->ops[loop.begin].arg)];
+            const auto  begin = program->ops[loop.begin].source;
+
+            auto text = std::string{code.substr(begin, end.source_end - begin)};
+            std::replace(text.begin(), text.end(), '\n', ' ');
+
+            fmt::print(
+                file,
+                "{:>6.2f}% cycles {:>6.2f}% ops  {}  entered {}, {} iterations  {}{}\n",
+                percent(loop.cycles, total_cycles),
+                percent(loop.ops, total_ops),
+                loop_frame(loop.begin),
+                loop.entered,
+                loop.iterations,
+                std::string_view{text}.substr(0, 40),
+                text.size() > 40 ? "..." : "");
+        }
+    }
+};
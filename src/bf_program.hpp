@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// parsed form of a brainfuck program shared by the non-template engines. Runs of `+-` and `<>` are folded into a
+// single op and loops carry the index of their partner, so no engine has to scan the code for a matching bracket
+enum class bf_op_kind : std::uint8_t
+{
+    add,        // cell[ptr] += arg
+    move,       // ptr += arg
+    output,     // output cell[ptr]
+    input,      // cell[ptr] = next input byte
+    loop_begin, // if cell[ptr] == 0 continue after the matching loop_end
+    loop_end,   // if cell[ptr] != 0 continue after the matching loop_begin
+    fused,      // superinstruction arg of the set the program was fused with, standing in for a run of add/move ops
+    set,        // cell[ptr] = arg, a cleared cell with no write when it stays zero past the end of the tape
+};
+
+struct bf_op
+{
+    bf_op_kind  kind;
+    int         arg        = 0; // amount for add/move, value for set, index of the partner op for loop_begin/loop_end
+    std::size_t source     = 0; // offset of the first code character folded into this op
+    std::size_t source_end = 0; // one past the offset of the last code character folded into this op
+};
+
+enum class bf_parse_status : std::uint8_t
+{
+    ok,
+    unmatched_loop_begin,
+    unmatched_loop_end,
+};
+
+// superinstruction: a run of add/move ops executed by a single fused handler, given by its canonical code ("->+<")
+struct bf_superop
+{
+    std::string_view code;
+};
+
+// superinstruction set policy of the runtime engine's machine: the `set` to fuse the program with and a `run` handler
+// executing one of them through the machine's `fused_add`/`fused_move`. Real sets, with a handler specialized per
+// superinstruction, are generated from a profile by tools/bf_superops.cpp
+struct bf_no_superops
+{
+    static constexpr std::array<bf_superop, 0> set{};
+
+    template<typename Machine>
+    static constexpr auto run(Machine&, int) -> void
+    {
+    }
+};
+
+constexpr auto bf_is_command(char c) -> bool
+{
+    switch (c)
+    {
+        case '+':
+        case '-':
+        case '<':
+        case '>':
+        case '.':
+        case ',':
+        case '[':
+        case ']':
+            return true;
+        default:
+            return false;
+    }
+}
+
+struct bf_program
+{
+    std::vector<bf_op> ops;
+    bf_parse_status    status       = bf_parse_status::ok;
+    std::size_t        error_source = 0;     // offset of the offending bracket when status != ok
+    bool               optimized    = false; // ran through `bf_optimize` (bf_dataflow.hpp) already
+
+    constexpr bf_program() = default;
+
+    // parses in place rather than returning a `bf_program` by value, g++ 12 fails with an internal compiler error
+    // evaluating the implicit move of a `bf_program` that comes from an imported module
+    constexpr explicit bf_program(std::string_view code)
+    {
+        std::vector<std::size_t> open_loops;
+
+        for (std::size_t i = 0; i < code.size(); ++i)
+        {
+            const char c = code[i];
+            switch (c)
+            {
+                case '+':
+                case '-':
+                case '<':
+                case '>':
+                {
+                    const bool is_add = (c == '+' || c == '-');
+                    const auto kind   = is_add ? bf_op_kind::add : bf_op_kind::move;
+                    const int  delta  = (c == '+' || c == '>') ? 1 : -1;
+
+                    // note zero-sum runs are kept, a net +0 is still a write and must still grow the tape
+                    if (!ops.empty() && ops.back().kind == kind && ops.back().source_end == i)
+                    {
+                        ops.back().arg += delta;
+                        ops.back().source_end = i + 1;
+                    }
+                    else
+                    {
+                        ops.push_back(bf_op{kind, delta, i, i + 1});
+                    }
+                    break;
+                }
+                case '.':
+                    ops.push_back(bf_op{bf_op_kind::output, 0, i, i + 1});
+                    break;
+                case ',':
+                    ops.push_back(bf_op{bf_op_kind::input, 0, i, i + 1});
+                    break;
+                case '[':
+                    open_loops.push_back(ops.size());
+                    ops.push_back(bf_op{bf_op_kind::loop_begin, 0, i, i + 1});
+                    break;
+                case ']':
+                {
+                    if (open_loops.empty())
+                    {
+                        status       = bf_parse_status::unmatched_loop_end;
+                        error_source = i;
+                        return;
+                    }
+
+                    const auto begin = open_loops.back();
+                    open_loops.pop_back();
+
+                    ops[begin].arg = static_cast<int>(ops.size());
+                    ops.push_back(bf_op{bf_op_kind::loop_end, static_cast<int>(begin), i, i + 1});
+                    break;
+                }
+                default:
+                    // every other character is a comment
+                    break;
+            }
+        }
+
+        if (!open_loops.empty())
+        {
+            status       = bf_parse_status::unmatched_loop_begin;
+            error_source = ops[open_loops.back()].source;
+        }
+    }
+
+    // replaces every run of ops spelled exactly like one of `superops` (an array or vector of `bf_superop`) with a
+    // single fused op, trying them in order
+    template<typename SuperopList>
+    constexpr auto fuse(const SuperopList& superops) -> void
+    {
+        const std::size_t count = superops.size();
+        if (status != bf_parse_status::ok || count == 0)
+        {
+            return;
+        }
+
+        std::vector<std::vector<bf_op>> patterns(count);
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            const bf_program parsed{superops[s].code};
+            patterns[s] = parsed.ops;
+        }
+
+        std::vector<bf_op>       fused_ops;
+        std::vector<std::size_t> new_index(ops.size(), 0);
+        for (std::size_t i = 0; i < ops.size();)
+        {
+            new_index[i] = fused_ops.size();
+
+            std::size_t superop = 0;
+            while (superop < count && !matches(i, patterns[superop]))
+            {
+                ++superop;
+            }
+
+            if (superop < count)
+            {
+                const auto length = patterns[superop].size();
+                fused_ops.push_back(
+                    bf_op{bf_op_kind::fused, static_cast<int>(superop), ops[i].source, ops[i + length - 1].source_end});
+                i += length;
+            }
+            else
+            {
+                fused_ops.push_back(ops[i]);
+                ++i;
+            }
+        }
+
+        // loops are never part of a superinstruction so every partner index has a new one
+        for (auto& op : fused_ops)
+        {
+            if (op.kind == bf_op_kind::loop_begin || op.kind == bf_op_kind::loop_end)
+            {
+                op.arg = static_cast<int>(new_index[static_cast<std::size_t>(op.arg)]);
+            }
+        }
+
+        ops = fused_ops;
+    }
+
+    constexpr auto matches(std::size_t i, const std::vector<bf_op>& pattern) const -> bool
+    {
+        if (pattern.empty() || i + pattern.size() > ops.size())
+        {
+            return false;
+        }
+
+        for (std::size_t j = 0; j < pattern.size(); ++j)
+        {
+            const auto& op = ops[i + j];
+            if ((op.kind != bf_op_kind::add && op.kind != bf_op_kind::move) || op.kind != pattern[j].kind ||
+                op.arg != pattern[j].arg)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
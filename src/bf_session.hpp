@@ -0,0 +1,153 @@
+#pragma once
+
+#include "bf_constexpr.hpp"
+#include "bf_program.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// forkable sessions for the runtime engine: a session is the machine state of one run (code position, pointer, tape,
+// input position, pending output) kept apart from the program, so many sessions share one parse and one
+// `bf_session_runner`. The tape is made of refcounted pages copied on their first write, so copying a session copies
+// its page table and every page stays shared until one side writes to it. A program's common setup phase then runs
+// once, and the warmed session is forked once per input
+
+// copy-on-write tape policy for `bf_basic_constexpr_machine`. Pages are allocated on their first write, a page nobody
+// wrote to reads as zeros without taking any memory
+struct bf_cow_tape
+{
+    static constexpr std::size_t page_size = 4096;
+
+    using page = std::array<std::int8_t, page_size>;
+
+    std::vector<std::shared_ptr<page>> pages = std::vector<std::shared_ptr<page>>(1);
+    std::size_t                        cells = 4; // same initial size as `bf_vector_tape`
+
+    auto size() const -> std::size_t { return cells; }
+
+    // pages shared with other sessions included, they count for every session holding them
+    auto resident() const -> std::size_t
+    {
+        std::size_t allocated = 0;
+        for (const auto& p : pages)
+        {
+            allocated += p ? page_size : 0;
+        }
+        return allocated;
+    }
+
+    auto get(std::size_t index) const -> std::int8_t
+    {
+        const auto& p = pages[index / page_size];
+        return p ? (*p)[index % page_size] : 0;
+    }
+
+    auto set(std::size_t index, std::int8_t value) -> void
+    {
+        auto& p = pages[index / page_size];
+        if (!p)
+        {
+            p = std::make_shared<page>();
+        }
+        else if (p.use_count() > 1)
+        {
+            // only ever racy towards an extra copy: a use count of 1 means no other session can reach the page
+            p = std::make_shared<page>(*p);
+        }
+
+        (*p)[index % page_size] = value;
+    }
+
+    auto resize(std::size_t size) -> void
+    {
+        cells = size;
+        pages.resize((size + page_size - 1) / page_size);
+    }
+};
+
+using bf_cow_state   = bf_basic_constexpr_state<bf_cow_tape>;
+using bf_cow_machine = bf_basic_constexpr_machine<bf_cow_tape, bf_no_superops>;
+
+struct bf_session
+{
+    bf_cow_state     state;
+    bf_run_summary   summary;
+    std::string_view input;
+    std::string      output; // written by the program and not taken by the caller yet
+
+    // a copy sharing every page, for going back to this point later
+    auto snapshot() const -> bf_session { return *this; }
+
+    // a copy sharing every page that continues with `more_input`, typically from a session waiting for input
+    auto fork(std::string_view more_input) const -> bf_session
+    {
+        auto forked            = *this;
+        forked.input           = more_input;
+        forked.state.input_pos = 0;
+        return forked;
+    }
+};
+
+// runs sessions of one program, one at a time: a session's state is moved into the runner's machine for the run and
+// moved back out afterwards, nothing is copied
+class bf_session_runner
+{
+public:
+    explicit bf_session_runner(const bf_program& program) : m_machine(program, {}) {}
+
+    // a fresh session, already failed if the program didn't parse
+    auto start(std::string_view input) const -> bf_session { return bf_session{{}, m_machine.summary, input, {}}; }
+
+    // runs until the program finishes or fails, or stops in front of a `,` once the session's input is used up. A
+    // session stopped there continues from a `fork` with more input
+    auto run(bf_session& session) -> void
+    {
+        enter(session);
+
+        auto           output = [&](char c) { session.output += c; };
+        bf_no_profiler profiler;
+        while (m_machine.running() && !at_exhausted_input())
+        {
+            m_machine.step(output, profiler);
+        }
+        m_machine.summary.memory_usage    = m_machine.state.tape.size();
+        m_machine.summary.resident_memory = m_machine.state.tape.resident();
+
+        leave(session);
+    }
+
+    auto waiting_for_input(const bf_session& session) const -> bool
+    {
+        const auto& ops = m_machine.program.ops;
+        return session.summary.status == bf_status::ok && session.state.pc < ops.size() &&
+               ops[session.state.pc].kind == bf_op_kind::input && session.state.input_pos == session.input.size();
+    }
+
+private:
+    auto at_exhausted_input() const -> bool
+    {
+        return m_machine.program.ops[m_machine.state.pc].kind == bf_op_kind::input &&
+               m_machine.state.input_pos == m_machine.input.size();
+    }
+
+    auto enter(bf_session& session) -> void
+    {
+        std::swap(m_machine.state, session.state);
+        std::swap(m_machine.summary, session.summary);
+        m_machine.input = session.input;
+    }
+
+    auto leave(bf_session& session) -> void
+    {
+        std::swap(m_machine.state, session.state);
+        std::swap(m_machine.summary, session.summary);
+    }
+
+    bf_cow_machine m_machine;
+};
@@ -0,0 +1,335 @@
+#pragma once
+
+#include "bf_constexpr.hpp"
+#include "bf_program.hpp"
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// streaming runtime engine: the constexpr engine's machine driven from a coroutine that reads `,` input from and
+// writes `.` output to non-blocking file descriptors (pipes, sockets). A session suspends whenever its input buffer is
+// empty or its output buffer is full and the descriptor isn't ready, `bf_stream_driver` resumes it from an epoll loop,
+// so one thread runs any number of sessions. Input is read straight into the buffer the machine reads from and output
+// is written straight from the buffer the machine writes to, in chunks of the buffer size or, once the input buffer
+// runs empty, whatever is pending so a peer waiting for a reply gets it. Every byte passes through the interpreter so
+// there's nothing for splice to move. End of input behaves like the end of a `_static` input, a
+// read past it fails with `bf_status::input_exhausted`. Writers should ignore SIGPIPE, a closed reader is an io_error
+
+struct bf_stream_task
+{
+    struct promise_type
+    {
+        auto get_return_object() -> bf_stream_task
+        {
+            return bf_stream_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        // started by the driver once the session is registered, and kept after finishing until the driver is done
+        auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() noexcept -> std::suspend_always { return {}; }
+        auto return_void() -> void {}
+        auto unhandled_exception() -> void { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    explicit bf_stream_task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    bf_stream_task(bf_stream_task&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    bf_stream_task(const bf_stream_task&)                    = delete;
+    auto operator=(const bf_stream_task&) -> bf_stream_task& = delete;
+    auto operator=(bf_stream_task&&) -> bf_stream_task&      = delete;
+
+    ~bf_stream_task()
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+    }
+};
+
+// the state of one run, kept apart from the program the same way as a `bf_session`: it's moved into the driver's one
+// machine while the session is resumed and moved back out when it suspends
+struct bf_stream_session
+{
+    int                              in_fd;
+    int                              out_fd;
+    bf_constexpr_machine::state_type state;
+    bf_run_summary                   summary;
+    std::vector<char>                input;
+    std::size_t                      input_size = 0; // bytes of `input` read from `in_fd`, the machine's input
+    std::vector<char>                output;
+    std::size_t                      output_size    = 0;
+    std::size_t                      output_flushed = 0;
+    bool                             input_eof      = false;
+    int                              wait_fd        = -1; // descriptor and epoll events the session is waiting for
+    std::uint32_t                    wait_events    = 0;
+    void*                            user_data      = nullptr;
+    std::unique_ptr<bf_stream_task>  task;
+
+    bf_stream_session(const bf_run_summary& parsed, int in, int out, std::size_t buffer_size)
+        : in_fd(in), out_fd(out), summary(parsed), input(buffer_size), output(buffer_size)
+    {
+    }
+};
+
+struct bf_stream_wait
+{
+    bf_stream_session& session;
+    int                fd;
+    std::uint32_t      events;
+
+    auto await_ready() const noexcept -> bool { return false; }
+    auto await_suspend(std::coroutine_handle<>) noexcept -> void
+    {
+        session.wait_fd     = fd;
+        session.wait_events = events;
+    }
+    auto await_resume() const noexcept -> void {}
+};
+
+// `machine` holds the session's state whenever the coroutine runs
+inline auto bf_stream_run(bf_stream_session& session, bf_constexpr_machine& machine) -> bf_stream_task
+{
+    auto           output   = [&](char c) { session.output[session.output_size++] = c; };
+    bf_no_profiler profiler;
+
+    // every op that fails the run is somewhere in the code, I/O errors point at the `,` or `.` that needed it
+    auto fail_io = [&] {
+        const auto& op = machine.program.ops[machine.state.pc < machine.program.ops.size() ? machine.state.pc : 0];
+        machine.fail(bf_status::io_error, op.source, op.source_end);
+    };
+
+    for (;;)
+    {
+        const bool finished = !machine.running();
+        const bool starved  = !finished && machine.program.ops[machine.state.pc].kind == bf_op_kind::input &&
+                             machine.state.input_pos == machine.input.size() && !session.input_eof;
+
+        // flushed when full, the next `.` has to have room, once more when the program is done, and before reading more
+        // input: a peer talking request/response only sends more once it has the reply so far
+        if (session.output_size == session.output.size() || ((finished || starved) && session.output_size > 0))
+        {
+            const auto written = ::write(
+                session.out_fd,
+                session.output.data() + session.output_flushed,
+                session.output_size - session.output_flushed);
+
+            if (written >= 0)
+            {
+                session.output_flushed += static_cast<std::size_t>(written);
+                if (session.output_flushed == session.output_size)
+                {
+                    session.output_size    = 0;
+                    session.output_flushed = 0;
+                }
+            }
+            else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                co_await bf_stream_wait{session, session.out_fd, EPOLLOUT};
+            }
+            else if (errno != EINTR)
+            {
+                // nobody is reading anymore, drop the rest
+                session.output_size = 0;
+                if (!finished)
+                {
+                    fail_io();
+                }
+            }
+            continue;
+        }
+
+        if (finished)
+        {
+            break;
+        }
+
+        if (starved)
+        {
+            const auto read = ::read(session.in_fd, session.input.data(), session.input.size());
+            if (read > 0)
+            {
+                session.input_size      = static_cast<std::size_t>(read);
+                machine.input           = std::string_view{session.input.data(), session.input_size};
+                machine.state.input_pos = 0;
+            }
+            else if (read == 0)
+            {
+                // the machine reports input_exhausted on its own when it steps the `,`
+                session.input_eof = true;
+            }
+            else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                co_await bf_stream_wait{session, session.in_fd, EPOLLIN};
+            }
+            else if (errno != EINTR)
+            {
+                fail_io();
+            }
+            continue;
+        }
+
+        machine.step(output, profiler);
+    }
+
+    machine.summary.memory_usage    = machine.state.tape.size();
+    machine.summary.resident_memory = machine.state.tape.resident();
+}
+
+// runs sessions of one program over pairs of non-blocking descriptors from a single epoll loop, every session on the
+// driver's one parse of it. A finished session has its descriptors closed, so the peer sees end of file, and is
+// reported to `on_finished` before it's destroyed. Sessions still running when the driver is destroyed are destroyed
+// with it and have their descriptors closed. Everything but `notify` has to be called from the thread calling `poll`
+class bf_stream_driver
+{
+public:
+    using finished_callback = std::function<void(const bf_stream_session&)>;
+
+    bf_stream_driver(const bf_program& program, std::size_t buffer_size, finished_callback on_finished)
+        : m_machine(program, {})
+        , m_buffer_size(buffer_size)
+        , m_on_finished(std::move(on_finished))
+        , m_epoll_fd(::epoll_create1(EPOLL_CLOEXEC))
+        , m_wake_fd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+        epoll_event event{};
+        event.events   = EPOLLIN;
+        event.data.ptr = nullptr;
+        ::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &event);
+    }
+
+    bf_stream_driver(const bf_stream_driver&)                    = delete;
+    auto operator=(const bf_stream_driver&) -> bf_stream_driver& = delete;
+
+    ~bf_stream_driver()
+    {
+        for (const auto& session : m_sessions)
+        {
+            close_descriptors(*session.second);
+        }
+        m_sessions.clear();
+
+        ::close(m_wake_fd);
+        ::close(m_epoll_fd);
+    }
+
+    // takes ownership of both descriptors, which may be the same one (a socket)
+    auto add(int in_fd, int out_fd, void* user_data = nullptr) -> void
+    {
+        for (const auto fd : {in_fd, out_fd})
+        {
+            ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+
+        auto  owned        = std::make_unique<bf_stream_session>(m_machine.summary, in_fd, out_fd, m_buffer_size);
+        auto* session      = owned.get();
+        session->user_data = user_data;
+        session->task      = std::make_unique<bf_stream_task>(bf_stream_run(*session, m_machine));
+        m_sessions.emplace(session, std::move(owned));
+        resume(session);
+    }
+
+    // wakes a `poll` blocked in another thread, e.g. after queueing descriptors for it to `add`
+    auto notify() -> void
+    {
+        const std::uint64_t one = 1;
+        [[maybe_unused]] const auto written = ::write(m_wake_fd, &one, sizeof(one));
+    }
+
+    auto active() const -> std::size_t { return m_sessions.size(); }
+
+    // waits up to `timeout_ms` (-1 for no limit) and resumes every session whose descriptor became ready
+    auto poll(int timeout_ms) -> void
+    {
+        epoll_event events[256];
+        const auto  count = ::epoll_wait(m_epoll_fd, events, 256, timeout_ms);
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.ptr == nullptr)
+            {
+                std::uint64_t value;
+                [[maybe_unused]] const auto read = ::read(m_wake_fd, &value, sizeof(value));
+                continue;
+            }
+
+            resume(static_cast<bf_stream_session*>(events[i].data.ptr));
+        }
+    }
+
+private:
+    auto resume(bf_stream_session* session) -> void
+    {
+        // the machine's own state is the one of a fresh run whenever no session is resumed
+        std::swap(m_machine.state, session->state);
+        std::swap(m_machine.summary, session->summary);
+        m_machine.input = std::string_view{session->input.data(), session->input_size};
+
+        session->wait_fd = -1;
+        session->task->handle.resume();
+
+        std::swap(m_machine.state, session->state);
+        std::swap(m_machine.summary, session->summary);
+
+        if (session->task->handle.done())
+        {
+            finish(session);
+            return;
+        }
+
+        // one shot so a session is only ever resumed for the one descriptor it's waiting on, re-armed per wait
+        epoll_event event{};
+        event.events   = session->wait_events | EPOLLONESHOT;
+        event.data.ptr = session;
+        if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, session->wait_fd, &event) != 0)
+        {
+            ::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, session->wait_fd, &event);
+        }
+    }
+
+    auto close_descriptors(const bf_stream_session& session) -> void
+    {
+        for (const auto fd : {session.in_fd, session.out_fd})
+        {
+            ::epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+        ::close(session.in_fd);
+        if (session.out_fd != session.in_fd)
+        {
+            ::close(session.out_fd);
+        }
+    }
+
+    auto finish(bf_stream_session* session) -> void
+    {
+        // moved out rather than extracted, g++ 12 crashes on an unordered_map node handle in a -fmodules-ts build
+        auto owned = std::move(m_sessions.at(session));
+        m_sessions.erase(session);
+
+        close_descriptors(*session);
+        m_on_finished(*session);
+    }
+
+    bf_constexpr_machine m_machine;
+    std::size_t          m_buffer_size;
+    finished_callback    m_on_finished;
+    int                  m_epoll_fd;
+    int                  m_wake_fd;
+
+    // after the machine, the sessions' coroutines go first
+    std::unordered_map<bf_stream_session*, std::unique_ptr<bf_stream_session>> m_sessions;
+};
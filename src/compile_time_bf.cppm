@@ -0,0 +1,34 @@
+// module interface exporting `basic_static_string` and its concepts, the preprocessor, the parsed program with its
+// dataflow pass, the template engine and the constexpr engine. The headers stay the single source of truth, they're
+// included in the module purview so the module is built once and importers skip parsing them. The other engine headers
+// are included as headers: the stream engine (bf_stream.hpp) runs on POSIX descriptors and epoll and the profiler
+// (bf_profiler.hpp) needs fmt and x86intrin.h, neither of which belongs in the global module fragment, and g++ 12 -O2
+// crashes compiling an importer that uses the `std::shared_ptr` pages of the forkable sessions (bf_session.hpp).
+// Macros can't be exported, `STATIC_STRING` is only available by including type_helpers.hpp
+module;
+
+// every standard header the exported headers include has to be included here first. Their own #include lines then
+// see the include guards and expand to nothing, where they'd otherwise pull the standard library into the `export`
+// block below and attach it to this module. A header gaining a new standard include needs it added to this list
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+export module compile_time_bf;
+
+export
+{
+#include "type_helpers.hpp"
+
+#include "bf_constexpr.hpp"
+#include "bf_dataflow.hpp"
+#include "bf_interpreter.hpp"
+#include "bf_preprocess.hpp"
+#include "bf_program.hpp"
+}
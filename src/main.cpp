@@ -1,316 +1,16 @@
 #include <fmt/format.h>
 
-#define TEST_STATIC_STRING
+// included rather than `import compile_time_bf`, g++ 12 miscompiles handing the module's `std::string_view` to fmt
+#include "bf_constexpr.hpp"
+#include "bf_interpreter.hpp"
+#include "bf_preprocess.hpp"
 #include "type_helpers.hpp"
 
-template<static_string_of_concept<int8_t> Data = basic_static_string<int8_t, 0, 0, 0, 0>>
-struct bf_memory
-{
-    static constexpr std::size_t size = Data::size;
-
-    template<std::size_t I>
-    struct get_value_helper : std::integral_constant<int8_t, 0>
-    {
-    };
-
-    template<std::size_t I>
-        requires(I < Data::size)
-    struct get_value_helper<I> : std::integral_constant<int8_t, Data::template at<I>>
-    {
-    };
-
-    template<std::size_t I>
-    static constexpr auto get_value = get_value_helper<I>::value;
-
-    template<std::size_t I, int8_t V>
-    struct set_value_helper
-    {
-        static constexpr std::size_t size_needed   = I + 1;
-        static constexpr std::size_t growth_needed = size_needed - Data::size - 1; // minus 1 to append the new value
-        using type =
-            bf_memory<typename Data::template append<make_static_string<int8_t, growth_needed>>::template append_chars<V>>;
-    };
-
-    template<std::size_t I, int8_t V>
-        requires(I < Data::size)
-    struct set_value_helper<I, V>
-    {
-        using type = bf_memory<typename Data::template replace<I, V>>;
-    };
-
-    template<std::size_t I, int8_t V>
-    using set_value = set_value_helper<I, V>::type;
-};
-
-template<static_string_of_concept<char> Input, std::size_t I>
-struct bf_get_instruction : std::integral_constant<char, 0>
-{
-};
-
-template<static_string_of_concept<char> Code, std::size_t I>
-    requires(I < Code::size)
-struct bf_get_instruction<Code, I> : std::integral_constant<char, Code::template at<I>>
-{
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input                    = basic_static_string<char>,
-    typename Memory                                         = bf_memory<>,
-    std::size_t                           InterpretPosition = 0,
-    std::size_t                           Ptr               = 0,
-    static_string_of_concept<char>        Output            = basic_static_string<char>,
-    static_string_of_concept<std::size_t> LoopStack         = basic_static_string<std::size_t>,
-    char                                  Instruction       = bf_get_instruction<Code, InterpretPosition>::value>
-struct bf_interpreter
-{
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '\0'>
-{
-    struct final_result
-    {
-        static constexpr std::size_t memory_usage = Memory::size;
-        using output                              = Output;
-    };
-
-    using result = final_result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '+'>
-{
-    using result = bf_interpreter<
-        Code,
-        Input,
-        typename Memory::template set_value<Ptr, static_cast<int8_t>(Memory::template get_value<Ptr> + 1)>,
-        InterpretPosition + 1,
-        Ptr,
-        Output,
-        LoopStack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '-'>
-{
-    using result = bf_interpreter<
-        Code,
-        Input,
-        typename Memory::template set_value<Ptr, static_cast<int8_t>(Memory::template get_value<Ptr> - 1)>,
-        InterpretPosition + 1,
-        Ptr,
-        Output,
-        LoopStack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '>'>
-{
-    using result = bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr + 1, Output, LoopStack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '<'>
-{
-    using result = bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr - 1, Output, LoopStack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '.'>
-{
-    using result =
-        bf_interpreter<Code, Input, Memory, InterpretPosition + 1, Ptr, typename Output::push_back<Memory::template get_value<Ptr>>, LoopStack>::
-            result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-    requires(Input::size > 0)
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ','>
-{
-    using result = bf_interpreter<
-        Code,
-        typename Input::pop_front<>,
-        typename Memory::template set_value<Ptr, static_cast<int8_t>(Input::front)>,
-        InterpretPosition + 1,
-        Ptr,
-        Output,
-        LoopStack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-    requires(Input::size == 0)
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ','>
-{
-    static_assert(Input::size > 0, "Brainfuck Error: tried to read more from input than was provided");
-};
-
-template<
-    static_string_of_concept<char> Code,
-    std::size_t                    CheckPosition,
-    std::size_t                    StackSize,
-    char                           Instruction = bf_get_instruction<Code, CheckPosition>::value>
-struct bf_get_forward_jump_helper_finder
-{
-    static_assert(Instruction != 0, "Brainfuck Error: found [ without corresponding ]");
-};
-
-template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize, char Instruction>
-    requires(Instruction != 0)
-struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, Instruction>
-    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize>
-{
-};
-
-template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize>
-struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, '['>
-    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize + 1>
-{
-};
-
-template<static_string_of_concept<char> Code, std::size_t CheckPosition, std::size_t StackSize>
-struct bf_get_forward_jump_helper_finder<Code, CheckPosition, StackSize, ']'>
-    : bf_get_forward_jump_helper_finder<Code, CheckPosition + 1, StackSize - 1>
-{
-};
-
-template<static_string_of_concept<char> Code, std::size_t CheckPosition>
-struct bf_get_forward_jump_helper_finder<Code, CheckPosition, 0, ']'>
-    : std::integral_constant<std::size_t, CheckPosition + 1>
-{
-};
-
-template<static_string_of_concept<char> Code, std::size_t InterpretPosition, static_string_of_concept<std::size_t> LoopStack, bool jumping>
-struct bf_get_forward_jump_helper
-{
-    using loop_stack                           = typename LoopStack::template push_back<InterpretPosition>;
-    static constexpr std::size_t next_position = InterpretPosition + 1;
-};
-
-template<static_string_of_concept<char> Code, std::size_t InterpretPosition, static_string_of_concept<std::size_t> LoopStack>
-struct bf_get_forward_jump_helper<Code, InterpretPosition, LoopStack, true>
-{
-    using loop_stack = LoopStack;
-    static constexpr std::size_t next_position = bf_get_forward_jump_helper_finder<Code, InterpretPosition + 1, 0>::value;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, '['>
-{
-    static constexpr bool jump_forward = Memory::template get_value<Ptr> == 0;
-    using jump_helper                  = bf_get_forward_jump_helper<Code, InterpretPosition, LoopStack, jump_forward>;
-
-    using result =
-        bf_interpreter<Code, Input, Memory, jump_helper::next_position, Ptr, Output, typename jump_helper::loop_stack>::result;
-};
-
-template<
-    static_string_of_concept<char> Code,
-    static_string_of_concept<char> Input,
-    typename Memory,
-    std::size_t                           InterpretPosition,
-    std::size_t                           Ptr,
-    static_string_of_concept<char>        Output,
-    static_string_of_concept<std::size_t> LoopStack>
-struct bf_interpreter<Code, Input, Memory, InterpretPosition, Ptr, Output, LoopStack, ']'>
-{
-    static constexpr bool jump_back = Memory::template get_value<Ptr> != 0;
-    using result                    = bf_interpreter<
-        Code,
-        Input,
-        Memory,
-        (jump_back ? LoopStack::back : InterpretPosition + 1),
-        Ptr,
-        Output,
-        typename LoopStack::template pop_back<>>::result;
-};
-
-template<typename CType, CType... Values>
-constexpr auto operator""_bf()
-{
-    return typename bf_interpreter<basic_static_string<CType, Values...>>::result::output::create();
-}
-
-template<
-    static_string_creation_concept Code,
-    static_string_creation_concept Input,
-    typename Interpreter = bf_interpreter<typename Code::PType, typename Input::PType>>
-constexpr auto interpret_bf(Code, Input) -> Interpreter::result::output::create
-{
-    return {};
-}
-
-template<
-    static_string_creation_concept Code,
-    static_string_creation_concept Input,
-    typename Interpreter = bf_interpreter<typename Code::PType, typename Input::PType>>
-constexpr auto interpret_bf_ex(Code, Input)
-{
-    return std::pair<typename Interpreter::result::output::create, std::size_t>{{}, Interpreter::result::memory_usage};
-}
+// generated by `make` from programs/, see tools/bf_cache.cpp, tools/bf_superops.cpp and tools/bf_batch.cpp
+#include "bf_batch/table.hpp"
+#include "bf_cached/hello.hpp"
+#include "bf_cached/rot13.hpp"
+#include "bf_superops/corpus.hpp"
 
 int main(int argc, char** argv)
 {
@@ -340,4 +40,64 @@ int main(int argc, char** argv)
 
     static_assert(input_result.equals(rot13_expected_output));
     fmt::print("brainfuck input result: {} using {} bytes of memory\n", input_result.to_string_view(), memory_usage);
+
+    // once more with the superinstructions a profile of programs/ picked, every run of ops one of them covers is a
+    // single instantiation instead of one per character
+    constexpr auto fused_result = interpret_bf_fused<bf_superops::corpus>(rot13_bf, rot13_input);
+
+    static_assert(fused_result.equals(rot13_expected_output));
+    fmt::print(
+        "brainfuck input result with {} superinstructions: {}\n",
+        bf_superops::corpus::set.size(),
+        fused_result.to_string_view());
+
+    // same program on the constexpr backend, a single constant evaluation instead of a template per instruction.
+    // With `detect_cycles` a program that never halts fails right away with the offending loop in the diagnostic
+    // instead of running into the template depth or memory limit, e.g. "+[>+++++[-]<]"
+    constexpr auto constexpr_pair = interpret_bf_constexpr_ex<bf_options{.detect_cycles = true}>(rot13_bf, rot13_input);
+
+    static_assert(constexpr_pair.first.equals(rot13_expected_output));
+    static_assert(constexpr_pair.second == memory_usage);
+    fmt::print(
+        "constexpr brainfuck input result: {} using {} bytes of memory\n",
+        constexpr_pair.first.to_string_view(),
+        constexpr_pair.second);
+
+    // the same two programs from the build-time cache, no compile-time engine runs for these, the compiler only sees
+    // the resulting literal. Compared against the results above to check the cache agrees with the engines
+    static_assert(bf_cached::hello::output::equals<decltype(result)::PType>);
+    static_assert(bf_cached::rot13::output::equals<decltype(input_result)::PType>);
+    static_assert(bf_cached::rot13::memory_usage == memory_usage);
+    fmt::print(
+        "cached brainfuck input result: {} using {} bytes of memory\n",
+        bf_cached::rot13::output::to_string_view(),
+        bf_cached::rot13::memory_usage);
+
+    // the jobs of programs/batch.jobs, evaluated at compile time in translation units of their own and only linked
+    // in here, so this one doesn't pay for them
+    const auto* batch_rot13 = bf_batch::lookup("rot13");
+    fmt::print(
+        "batch brainfuck input result: {} using {} bytes of memory, {} jobs in the batch\n",
+        batch_rot13->output,
+        batch_rot13->memory_usage,
+        bf_batch::table.size());
+
+    // commented source with macros and repeats, preprocessing expands it and strips everything but the commands once
+    // so the interpreter never takes a step for a comment character
+    constexpr auto commented_source = R"(
+#define clear [-]
+#define newline $clear {+}*10 .
+        {+}*72 .  H
+        {+}*33 .  i
+        $newline
+    )"_static;
+
+    constexpr auto commented_code = preprocess_bf(commented_source);
+    static_assert(commented_code.size() == 72 + 1 + 33 + 1 + 3 + 10 + 1);
+    static_assert(interpret_bf(commented_code, ""_static).equals("Hi\n"_static));
+    fmt::print(
+        "preprocessed brainfuck: {} source characters expand to {} commands, result: {}",
+        commented_source.size(),
+        commented_code.size(),
+        interpret_bf(commented_code, ""_static).to_string_view());
 }
\ No newline at end of file
@@ -0,0 +1,175 @@
+// compile-time self tests, everything here is a static_assert so building this translation unit is running them:
+// `make test`
+
+// g++ 12 needs the standard library parts used by the module visible in the importer as well, e.g. the
+// `std::source_location` that `get_function_name` relies on and `std::string_view`'s comparison operators
+#include <array>
+#include <source_location>
+#include <string_view>
+
+import compile_time_bf;
+
+namespace impl_test
+{
+struct TestType
+{
+};
+struct Another_Type_For_Testing
+{
+};
+
+constexpr auto tt_name = typename_for<TestType>::create{};
+
+static_assert(get_typename<TestType>().equals("impl_test::TestType"_static));
+static_assert(get_typename<Another_Type_For_Testing>().equals("impl_test::Another_Type_For_Testing"_static));
+static_assert(tt_name.to_string_view() == "impl_test::TestType");
+static_assert(tt_name.prepend("derp::"_static).equals("derp::impl_test::TestType"_static));
+static_assert(tt_name.append("::derp"_static).equals("impl_test::TestType::derp"_static));
+static_assert(tt_name.remove_prefix<5>().equals("test::TestType"_static));
+static_assert(tt_name.remove_suffix<4>().equals("impl_test::Test"_static));
+static_assert(tt_name.trim_to<4>().equals("impl"_static));
+static_assert(tt_name.reverse_trim_to<4>().equals("Type"_static));
+static_assert(tt_name.substr<4, 5>().equals("_test"_static));
+static_assert(tt_name.erase<4, 5>().equals("impl::TestType"_static));
+static_assert(tt_name.insert<4>("_derp"_static).equals("impl_derp_test::TestType"_static));
+static_assert(tt_name.find_and_replace(":"_static, "?"_static).equals("impl_test?:TestType"_static));
+static_assert(tt_name.find_and_replace_all(":"_static, "?"_static).equals("impl_test??TestType"_static));
+static_assert(tt_name.to_lower().equals("impl_test::testtype"_static));
+static_assert(tt_name.to_upper().equals("IMPL_TEST::TESTTYPE"_static));
+static_assert(tt_name.at<2>() == 'p');
+static_assert(tt_name.count_of(':') == 2);
+static_assert(tt_name.equals("impl_test::TestType"_static));
+static_assert(tt_name.equals_case_insensitive("IMPL_TEST::TESTTYPE"_static));
+static_assert(tt_name.starts_with("impl_test::"_static));
+static_assert(tt_name.starts_with_case_insensitive("ImPl_TeSt::"_static));
+static_assert(tt_name.ends_with("TestType"_static));
+static_assert(tt_name.ends_with_case_insensitive("TeStTyPe"_static));
+static_assert(tt_name.find("Type"_static) == 15); // impl_test::Test*
+static_assert(tt_name.contains("::"_static));
+static_assert("aaaaaab"_static.find("aaab"_static) == 3);
+static_assert("abababc"_static.find("ababc"_static) == 2);
+static_assert(!"abababa"_static.contains("abc"_static));
+static_assert("aaaa"_static.find_and_replace_all("aa"_static, "b"_static).equals("bb"_static));
+static_assert(tt_name.find_and_replace_all("Test"_static, "TestTest"_static).equals("impl_test::TestTestType"_static));
+static_assert(tt_name.find_and_replace_all("::"_static, ""_static).equals("impl_testTestType"_static));
+
+static_assert(preprocess_bf("a comment, with. punctuation\n+[->+<]"_static).equals(",.+[->+<]"_static));
+static_assert(preprocess_bf("{+}*3 {>{-}*2}*2"_static).equals("+++>-->--"_static));
+static_assert(preprocess_bf("#define clear [-]\n#define next > $clear\n$clear $next $next"_static)
+                  .equals("[-]>[-]>[-]"_static));
+static_assert(preprocess_bf("#define two {+}*2\n{$two}*3 clearly not a macro: $ 5$"_static).equals("++++++"_static));
+static_assert(preprocess_bf("{+}*0"_static).equals(""_static));
+// a word that happens to name a macro and braces that aren't a repeat are still comments
+static_assert(
+    preprocess_bf("#define clear [-]\nclear the {first} cell: $clear }{ {+}*2 {"_static).equals("[-]++"_static));
+static_assert(preprocess_bf("{ note {+}*2 }*2"_static).equals("++++"_static));
+static_assert(bf_preprocess_run("#define foo-bar +", [](char) {}).status == bf_preprocess_status::invalid_macro_name);
+static_assert(bf_preprocess_run("#define  ", [](char) {}).status == bf_preprocess_status::malformed_define);
+static_assert(bf_preprocess_run("$undefined", [](char) {}).status == bf_preprocess_status::unknown_macro);
+
+static_assert("++++++++[>++++++++<-]>+."_bf.equals("A"_static));
+// g++ 12 loses the default `Options` of a function template imported from a module, so it is spelled out
+static_assert(interpret_bf_constexpr<bf_options{}>("++++++++[>++++++++<-]>+.,."_static, "z"_static).equals("Az"_static));
+static_assert(interpret_bf_constexpr_ex<bf_options{.detect_cycles = true}>("+[-]"_static, ""_static).second == 4);
+// the state repeats once the cell to the right wraps around, the loop it repeats in is the whole of `[>+<]`
+static_assert([] {
+    const auto summary = bf_constexpr_run("+[>+<]", "", bf_options{.detect_cycles = true}, [](char) {});
+    return summary.status == bf_status::non_terminating && summary.error_begin == 1 && summary.error_end == 6;
+}());
+#ifdef BF_SELF_TEST_NON_TERMINATING
+// has to fail to compile with bf_non_terminating_loop_check<true, 1, 6, ...> in the diagnostic, see `make test`
+constexpr auto never_halts = interpret_bf_constexpr<bf_options{.detect_cycles = true}>("+[>+<]"_static, ""_static);
+#endif
+
+// a superinstruction set the way tools/bf_superops.cpp generates one
+struct test_superops
+{
+    static constexpr std::array<bf_superop, 2> set = {{{">++++++++<-"}, {"->+<"}}};
+
+    template<typename Machine>
+    static constexpr auto run(Machine& machine, int superop) -> void
+    {
+        switch (superop)
+        {
+            case 0:
+                machine.fused_add(1, 8);
+                machine.fused_add(0, -1);
+                break;
+            case 1:
+                machine.fused_add(0, -1);
+                machine.fused_add(1, 1);
+                break;
+        }
+    }
+};
+
+static_assert(bf_lowered_code<test_superops, decltype("+[->+<]>[>++++++++<-]"_static)::PType>::type::to_string_view() ==
+              "+[\x01->+<\x02]>[\x01>++++++++<-\x02]");
+static_assert(interpret_bf_fused<test_superops>("++++++++[>++++++++<-]>+.,."_static, "z"_static).equals("Az"_static));
+static_assert(interpret_bf_fused<test_superops>("+++[->+<]>.>+."_static, ""_static).equals("\x03\x01"_static));
+static_assert([] {
+    bf_basic_constexpr_machine<bf_vector_tape, test_superops> machine{"++++++++[>++++++++<-]>+.", ""};
+    char                                                      output = 0;
+    auto                                                      write  = [&](char c) { output = c; };
+    const auto summary = machine.run(bf_options{}, write, bf_no_profiler{});
+    return machine.program.ops.size() == 7 && output == 'A' && summary.memory_usage == 4;
+}());
+
+static_assert([] {
+    bf_program program{"[comment, loop]+[-]+++[>+<-][-]>[-]>."};
+    const auto summary = bf_optimize(program);
+    return summary.ops_before == 23 && summary.ops_after == 12 && summary.dead_loops == 1 &&
+           summary.dropped_clears == 1 && summary.sets == 2 && program.ops[1].kind == bf_op_kind::set &&
+           program.ops[1].arg == 3;
+}());
+// adds apart in the source are two ops after parsing and one after the pass
+static_assert([] {
+    bf_program program{"+ +."};
+    const auto summary = bf_optimize(program);
+    return summary.ops_before == 3 && summary.ops_after == 2 && program.ops[0].arg == 2;
+}());
+static_assert(bf_lowered_code<bf_no_superops, decltype("[a, b]+[-]>[-]++[-]+++."_static)::PType>::type::to_string_view() ==
+              "+\x03" "aa>++\x03" "ad.");
+static_assert(interpret_bf("[a, b]+[-]>[-]++[-]+++."_static, ""_static).equals("\x03"_static));
+// a cleared cell past the end of the tape, the set it becomes doesn't grow the memory either
+static_assert(interpret_bf_ex("+[>>>>>>>>]<[-]"_static, ""_static).second == 4);
+static_assert(interpret_bf_constexpr_ex<bf_options{}>("+[>>>>>>>>]<[-]"_static, ""_static).second == 4);
+
+// a cell written a thousand cells to the right: the same span on both memories, two pages resident on the sparse one,
+// the first of the default 16 cells filled up and the second up to the cell written
+static_assert(interpret_bf_ex(preprocess_bf("+{>}*1000+++."_static), ""_static).second == 1001);
+static_assert([] {
+    constexpr auto result = interpret_bf_sparse_ex(preprocess_bf("+{>}*1000+++.{<}*1000."_static), ""_static);
+    return result.first.equals("\x03\x01"_static) && result.second.span == 1001 &&
+           result.second.resident == 16 + 1000 % 16 + 1;
+}());
+// within one page the sparse memory stores what the dense one does
+static_assert(interpret_bf_sparse_ex("+>+>+>+>+>+."_static, ""_static).second.resident == 6);
+static_assert(interpret_bf_ex("+>+>+>+>+>+."_static, ""_static).second == 6);
+static_assert(interpret_bf_sparse(preprocess_bf("{+}*4[>{+}*16<-]>.{>}*40,[-<+>]<<<."_static), "x"_static)
+                  .equals("@\0"_static));
+// a cell written 8000 cells to the right on the constexpr engine
+static_assert([] {
+    std::array<char, 8003> code{};
+    code.fill('>');
+    code.front()          = '+';
+    code[code.size() - 2] = '+';
+    code.back()           = '.';
+
+    char       output = 0;
+    auto       write  = [&](char c) { output = c; };
+    const auto dense  = bf_constexpr_run({code.data(), code.size()}, "", bf_options{}, write);
+    const auto sparse = bf_constexpr_run({code.data(), code.size()}, "", bf_options{.sparse_tape = true}, write);
+    return output == 1 && dense.memory_usage == 8001 && dense.resident_memory == 8001 &&
+           sparse.memory_usage == 8001 && sparse.resident_memory == 2 * bf_paged_tape::page_size;
+}());
+// the cycle check compares the pages of a sparse tape instead of every cell of its span
+static_assert(bf_constexpr_run(
+                  preprocess_bf("+[{>}*300+-{<}*300]"_static).to_string_view(),
+                  "",
+                  bf_options{.detect_cycles = true, .sparse_tape = true},
+                  [](char) {})
+                  .status == bf_status::non_terminating);
+} // namespace impl_test
+
+int main() {}
@@ -5,6 +5,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 template<typename CType, CType... Values>
 struct basic_static_string;
@@ -56,6 +57,18 @@ struct static_string_at : std::integral_constant<CType, std::array<CType, sizeof
     static_assert(I < sizeof...(Values), "static_string_at index not within range");
 };
 
+// turns the result of a constexpr computation (a `std::array` passed by value) into a `basic_static_string`
+template<auto Array, typename Indices = std::make_index_sequence<Array.size()>>
+struct static_string_from_array
+{
+};
+
+template<auto Array, std::size_t... Is>
+struct static_string_from_array<Array, std::index_sequence<Is...>>
+{
+    using type = basic_static_string<typename decltype(Array)::value_type, Array[Is]...>;
+};
+
 template<static_string_concept T, typename Indices, std::size_t Offset = 0>
 struct static_string_gather_by_indices
 {
@@ -92,33 +105,100 @@ struct static_string_substr
     using type           = static_string_gather_by_indices<T, index_sequence, Start>::type;
 };
 
-template<static_string_concept Haystack, static_string_of_concept<typename Haystack::char_type> Needle>
-struct static_string_index_of
-    : std::integral_constant<std::size_t, Haystack::to_string_view().find(Needle::to_string_view())>
+// Knuth-Morris-Pratt over the static storage arrays, one constant evaluation linear in haystack + needle size instead
+// of a type per candidate offset. Matches are non-overlapping and reported left to right
+template<typename CType>
+struct static_string_searcher
 {
+    std::basic_string_view<CType> needle;
+    std::vector<std::size_t>      fallback; // length of the longest proper border of needle[0, i]
+
+    constexpr explicit static_string_searcher(std::basic_string_view<CType> n) : needle(n), fallback(n.size(), 0)
+    {
+        for (std::size_t i = 1, matched = 0; i < needle.size(); ++i)
+        {
+            while (matched > 0 && needle[i] != needle[matched])
+            {
+                matched = fallback[matched - 1];
+            }
+
+            if (needle[i] == needle[matched])
+            {
+                ++matched;
+            }
+
+            fallback[i] = matched;
+        }
+    }
+
+    constexpr auto find(std::basic_string_view<CType> haystack, std::size_t start = 0) const -> std::size_t
+    {
+        if (needle.empty())
+        {
+            return start <= haystack.size() ? start : std::basic_string_view<CType>::npos;
+        }
+
+        for (std::size_t i = start, matched = 0; i < haystack.size(); ++i)
+        {
+            while (matched > 0 && haystack[i] != needle[matched])
+            {
+                matched = fallback[matched - 1];
+            }
+
+            if (haystack[i] == needle[matched] && ++matched == needle.size())
+            {
+                return i + 1 - needle.size();
+            }
+        }
+
+        return std::basic_string_view<CType>::npos;
+    }
+
+    constexpr auto count(std::basic_string_view<CType> haystack) const -> std::size_t
+    {
+        if (needle.empty())
+        {
+            return 0;
+        }
+
+        std::size_t result = 0;
+        for (auto pos = find(haystack); pos != haystack.npos; pos = find(haystack, pos + needle.size()))
+        {
+            ++result;
+        }
+
+        return result;
+    }
 };
 
-/*template<static_string_concept Haystack, static_string_of_concept<typename Haystack::char_type> Needle>
-struct static_string_index_of : std::integral_constant<std::size_t, Haystack::npos>
+// a loop instead of a fold over `Values...`, a fold expression nests one level per character
+template<typename CType>
+constexpr auto static_string_count_of(std::basic_string_view<CType> str, CType value) -> std::size_t
 {
-};
+    std::size_t result = 0;
+    for (const auto c : str)
+    {
+        result += (c == value ? 1 : 0);
+    }
+
+    return result;
+}
 
-template<std::size_t I>
-struct static_string_maybe_inc_index : std::integral_constant<std::size_t, (I == std::string_view::npos ? I : I + 1)>
+template<static_string_concept Haystack, static_string_of_concept<typename Haystack::char_type> Needle>
+struct static_string_index_of
+    : std::integral_constant<
+          std::size_t,
+          static_string_searcher<typename Haystack::char_type>{Needle::to_string_view()}.find(Haystack::to_string_view())>
 {
 };
 
 template<static_string_concept Haystack, static_string_of_concept<typename Haystack::char_type> Needle>
-    requires(Needle::size <= Haystack::size)
-struct static_string_index_of<Haystack, Needle>
+struct static_string_occurrences
     : std::integral_constant<
           std::size_t,
-          (Haystack::template starts_with<Needle>
-               ? 0
-               : static_string_maybe_inc_index<
-                     static_string_index_of<typename Haystack::template remove_prefix<1>, Needle>::value>::value)>
+          static_string_searcher<typename Haystack::char_type>{Needle::to_string_view()}.count(Haystack::to_string_view())>
 {
-};*/
+};
 
 template<
     static_string_concept                             Str,
@@ -131,30 +211,51 @@ struct static_string_find_and_replace
         std::conditional_t<pos == Str::npos, Str, typename Str::template erase<pos, Find::size>::template insert<pos, Replace>>;
 };
 
+// every match is replaced in a single pass, the result is built as an array and turned into exactly one new type.
+// Text produced by a replacement is not searched again, so a `Replace` containing `Find` is fine and an empty `Find`
+// replaces nothing
 template<
     static_string_concept                             Str,
     static_string_of_concept<typename Str::char_type> Find,
-    static_string_of_concept<typename Str::char_type> Replace,
-    typename = void>
+    static_string_of_concept<typename Str::char_type> Replace>
 struct static_string_find_and_replace_all
 {
-    using type = Str;
-};
+    using char_type = typename Str::char_type;
 
-template<
-    static_string_concept                             Str,
-    static_string_of_concept<typename Str::char_type> Find,
-    static_string_of_concept<typename Str::char_type> Replace>
-struct static_string_find_and_replace_all<Str, Find, Replace, std::enable_if_t<(Str::template find<Find> != Str::npos)>>
-{
-    static constexpr auto pos = Str::template find<Find>;
-    using type                = std::conditional_t<
-        pos == Str::npos,
-        Str,
-        typename static_string_find_and_replace_all<
-            typename Str::template erase<pos, Find::size>::template insert<pos, Replace>,
-            Find,
-            Replace>::type>;
+    static constexpr std::size_t matches     = static_string_occurrences<Str, Find>::value;
+    static constexpr std::size_t result_size = Str::size - matches * Find::size + matches * Replace::size;
+
+    static constexpr auto data = [] {
+        std::array<char_type, result_size> result{};
+        if constexpr (result_size > 0)
+        {
+            const auto                              haystack    = Str::to_string_view();
+            const auto                              replacement = Replace::to_string_view();
+            const static_string_searcher<char_type> searcher{Find::to_string_view()};
+
+            std::size_t written = 0;
+            std::size_t copied  = 0;
+            auto        copy    = [&](std::basic_string_view<char_type> part) {
+                for (const auto c : part)
+                {
+                    result[written++] = c;
+                }
+            };
+
+            for (auto pos = matches > 0 ? searcher.find(haystack) : haystack.npos; pos != haystack.npos;
+                 pos      = searcher.find(haystack, pos + Find::size))
+            {
+                copy(haystack.substr(copied, pos - copied));
+                copy(replacement);
+                copied = pos + Find::size;
+            }
+
+            copy(haystack.substr(copied));
+        }
+        return result;
+    }();
+
+    using type = static_string_from_array<data>::type;
 };
 
 template<typename CType, CType... Values>
@@ -260,7 +361,7 @@ struct basic_static_string
              : Values)...>;
 
     template<CType Value>
-    static constexpr std::size_t count_of = (0 + ... + (Values == Value ? 1 : 0));
+    static constexpr std::size_t count_of = static_string_count_of(to_string_view(), Value);
 
     template<static_string_of_concept<CType> T>
     static constexpr bool equals = std::is_same<T, Self>::value;
@@ -350,8 +451,18 @@ struct basic_static_string
             return {};
         }
 
-        constexpr auto pop_front() const -> PType::pop_front<>::create { return {}; }
-        constexpr auto pop_back() const -> PType::pop_back<>::create { return {}; }
+        // templates so they're only instantiated when called, the empty string has no `pop_front<1>`
+        template<std::size_t Count = 1>
+        constexpr auto pop_front() const -> PType::pop_front<Count>::create
+        {
+            return {};
+        }
+
+        template<std::size_t Count = 1>
+        constexpr auto pop_back() const -> PType::pop_back<Count>::create
+        {
+            return {};
+        }
 
         constexpr auto front() const -> CType { return PType::front; }
         constexpr auto back() const -> CType { return PType::back; }
@@ -398,7 +509,7 @@ struct basic_static_string
 
         constexpr auto to_upper() const -> PType::to_upper::create { return {}; }
 
-        constexpr auto count_of(CType c) const -> std::size_t { return (0 + ... + (Values == c ? 1 : 0)); }
+        constexpr auto count_of(CType c) const -> std::size_t { return static_string_count_of(to_string_view(), c); }
 
         template<static_string_creation_of_concept<CType> T>
         constexpr auto equals(T) const -> bool
@@ -535,6 +646,10 @@ struct typename_helper
     static constexpr std::size_t start_index = finder_tag.find(needle);
     static constexpr std::size_t end_index   = start_index + needle.size();
     static constexpr std::size_t extra_chars = finder_tag.size() - end_index;
+    // counted from the end of the function's own name, which is decorated differently where it's instantiated by an
+    // importer of a module (`get_function_name@compile_time_bf`) than where `finder_tag` is
+    static constexpr std::size_t name_end    = finder_tag.to_string_view().find('(');
+    static constexpr std::size_t prefix_size = start_index - name_end;
 
     static_assert(start_index != finder_tag.npos);
 };
@@ -543,8 +658,8 @@ template<typename T>
 consteval auto get_typename()
 {
     constexpr auto func_name = get_function_name<T>();
-    return func_name.template remove_prefix<typename_helper::start_index>()
-        .template remove_suffix<typename_helper::extra_chars>();
+    constexpr auto start     = func_name.to_string_view().find('(') + typename_helper::prefix_size;
+    return func_name.template remove_prefix<start>().template remove_suffix<typename_helper::extra_chars>();
 }
 
 struct value_name_helper
@@ -559,6 +674,9 @@ struct value_name_helper
     static constexpr std::size_t start_index = finder_tag.find(needle);
     static constexpr std::size_t end_index   = start_index + needle.size();
     static constexpr std::size_t extra_chars = finder_tag.size() - end_index;
+    // see typename_helper::prefix_size
+    static constexpr std::size_t name_end    = finder_tag.to_string_view().find('(');
+    static constexpr std::size_t prefix_size = start_index - name_end;
 
     static_assert(start_index != finder_tag.npos);
 };
@@ -567,8 +685,8 @@ template<auto V>
 consteval auto get_value_name()
 {
     constexpr auto func_name = get_function_name<V>();
-    return func_name.template remove_prefix<value_name_helper::start_index>()
-        .template remove_suffix<value_name_helper::extra_chars>();
+    constexpr auto start     = func_name.to_string_view().find('(') + value_name_helper::prefix_size;
+    return func_name.template remove_prefix<start>().template remove_suffix<value_name_helper::extra_chars>();
 }
 
 template<typename T>
@@ -576,44 +694,3 @@ using typename_for = decltype(get_typename<T>())::PType;
 
 template<auto V>
 using name_for = decltype(get_value_name<V>())::PType;
-
-#ifdef TEST_STATIC_STRING
-namespace impl_test
-{
-struct TestType
-{
-};
-struct Another_Type_For_Testing
-{
-};
-
-constexpr auto tt_name = typename_for<TestType>::create{};
-
-static_assert(get_typename<TestType>().equals("impl_test::TestType"_static));
-static_assert(get_typename<Another_Type_For_Testing>().equals("impl_test::Another_Type_For_Testing"_static));
-static_assert(tt_name.to_string_view() == "impl_test::TestType");
-static_assert(tt_name.prepend("derp::"_static).equals("derp::impl_test::TestType"_static));
-static_assert(tt_name.append("::derp"_static).equals("impl_test::TestType::derp"_static));
-static_assert(tt_name.remove_prefix<5>().equals("test::TestType"_static));
-static_assert(tt_name.remove_suffix<4>().equals("impl_test::Test"_static));
-static_assert(tt_name.trim_to<4>().equals("impl"_static));
-static_assert(tt_name.reverse_trim_to<4>().equals("Type"_static));
-static_assert(tt_name.substr<4, 5>().equals("_test"_static));
-static_assert(tt_name.erase<4, 5>().equals("impl::TestType"_static));
-static_assert(tt_name.insert<4>("_derp"_static).equals("impl_derp_test::TestType"_static));
-static_assert(tt_name.find_and_replace(":"_static, "?"_static).equals("impl_test?:TestType"_static));
-static_assert(tt_name.find_and_replace_all(":"_static, "?"_static).equals("impl_test??TestType"_static));
-static_assert(tt_name.to_lower().equals("impl_test::testtype"_static));
-static_assert(tt_name.to_upper().equals("IMPL_TEST::TESTTYPE"_static));
-static_assert(tt_name.at<2>() == 'p');
-static_assert(tt_name.count_of(':') == 2);
-static_assert(tt_name.equals("impl_test::TestType"_static));
-static_assert(tt_name.equals_case_insensitive("IMPL_TEST::TESTTYPE"_static));
-static_assert(tt_name.starts_with("impl_test::"_static));
-static_assert(tt_name.starts_with_case_insensitive("ImPl_TeSt::"_static));
-static_assert(tt_name.ends_with("TestType"_static));
-static_assert(tt_name.ends_with_case_insensitive("TeStTyPe"_static));
-static_assert(tt_name.find("Type"_static) == 15); // impl_test::Test*
-static_assert(tt_name.contains("::"_static));
-} // namespace impl_test
-#endif
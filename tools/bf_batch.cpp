@@ -0,0 +1,348 @@
+// compile-time batch evaluation spread over translation units: reads a list of (program, input) jobs and writes
+// `shards` generated sources, each evaluating its share of the jobs on a compile-time engine, plus a table linking
+// every result back together, so `make -jN` compiles the shards in parallel and no single compiler process holds the
+// whole instantiation load.
+//
+//   bf_batch [--headers] <shards> <job list> <output dir>
+//
+// writes <output dir>/shard_<i>.cpp, table.hpp (`bf_batch::result`, one extern per job, `table` and `lookup`) and
+// table.cpp. The shards `import compile_time_bf`, or include the headers with --headers, which is what
+// `make bench-modules` compares. A line of the job list is `<name> <template|constexpr> <code file> [input file]`,
+// `#` starts a comment. Every job is run once on the runtime engine first, so a broken job fails here with the
+// engine's diagnostic and the jobs are balanced over the shards by how many ops they execute. A file whose content
+// stays the same isn't written, changing one job only recompiles the shards it touches
+#include "bf_constexpr.hpp"
+#include "tool_io.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct batch_job
+{
+    std::string   name;
+    std::string   engine;
+    std::string   code_path;
+    std::string   input_path;
+    std::string   code;
+    std::string   input;
+    std::uint64_t ops   = 0; // executed on the runtime engine, the estimate of its compile-time cost
+    std::size_t   shard = 0;
+};
+
+auto read_jobs(const std::string& path, std::vector<batch_job>& jobs) -> bool
+{
+    const auto list = read_file(path);
+    if (!list)
+    {
+        fmt::print(stderr, "bf_batch: can't read {}\n", path);
+        return false;
+    }
+
+    std::istringstream lines{*list};
+    std::string        line;
+    for (std::size_t number = 1; std::getline(lines, line); ++number)
+    {
+        std::istringstream fields{line.substr(0, line.find('#'))};
+        batch_job          job;
+        if (!(fields >> job.name))
+        {
+            continue;
+        }
+
+        fields >> job.engine >> job.code_path >> job.input_path;
+        const bool reserved  = job.name == "result" || job.name == "table" || job.name == "lookup";
+        const bool duplicate = std::any_of(jobs.begin(), jobs.end(), [&](const auto& j) { return j.name == job.name; });
+        if (!is_identifier(job.name) || reserved || duplicate || job.code_path.empty() ||
+            (job.engine != "template" && job.engine != "constexpr"))
+        {
+            fmt::print(
+                stderr,
+                "{}:{}: expected `<name> <template|constexpr> <code file> [input file]` with a unique identifier "
+                "as the name\n",
+                path,
+                number);
+            return false;
+        }
+
+        const auto code  = read_file(job.code_path);
+        const auto input = job.input_path.empty() ? std::string{} : read_file(job.input_path);
+        if (!code || !input)
+        {
+            fmt::print(stderr, "{}:{}: can't read {}\n", path, number, !code ? job.code_path : job.input_path);
+            return false;
+        }
+
+        job.code  = *code;
+        job.input = *input;
+        jobs.push_back(job);
+    }
+
+    return true;
+}
+
+auto check(batch_job& job) -> bool
+{
+    bf_constexpr_machine machine{job.code, job.input};
+    bf_op_counter        counter;
+    auto                 discard = [](char) {};
+    const auto           summary = machine.run(bf_options{.detect_cycles = true}, discard, counter);
+    job.ops                      = counter.ops;
+
+    if (summary.status != bf_status::ok)
+    {
+        fmt::print(
+            stderr,
+            "{}: Brainfuck Error: {} at code offsets [{}, {})\n",
+            job.code_path,
+            bf_status_message(summary.status),
+            summary.error_begin,
+            summary.error_end);
+        return false;
+    }
+
+    return true;
+}
+
+// longest jobs first, each to the shard with the least work so far and of those the one with the fewest jobs, so with
+// at least as many jobs as shards no shard is left without one
+auto balance(std::vector<batch_job>& jobs, std::size_t shards) -> std::vector<std::uint64_t>
+{
+    std::vector<batch_job*> by_cost;
+    for (auto& job : jobs)
+    {
+        by_cost.push_back(&job);
+    }
+    std::stable_sort(by_cost.begin(), by_cost.end(), [](const auto* a, const auto* b) { return a->ops > b->ops; });
+
+    std::vector<std::uint64_t> load(shards, 0);
+    std::vector<std::size_t>   count(shards, 0);
+    for (auto* job : by_cost)
+    {
+        job->shard = 0;
+        for (std::size_t shard = 1; shard < shards; ++shard)
+        {
+            if (std::pair{load[shard], count[shard]} < std::pair{load[job->shard], count[job->shard]})
+            {
+                job->shard = shard;
+            }
+        }
+        load[job->shard] += job->ops;
+        ++count[job->shard];
+    }
+
+    return load;
+}
+
+auto write_if_changed(const std::filesystem::path& path, const std::string& content) -> void
+{
+    if (read_file(path) == content)
+    {
+        return;
+    }
+
+    std::ofstream{path, std::ios::binary} << content;
+}
+
+auto shard_source(
+    const std::string&            list_path,
+    const std::vector<batch_job>& jobs,
+    std::size_t                   shard,
+    std::size_t                   shards,
+    bool                          headers) -> std::string
+{
+    std::string body;
+    for (const auto& job : jobs)
+    {
+        if (job.shard != shard)
+        {
+            continue;
+        }
+
+        const auto code  = escape_literal(job.code);
+        const auto input = escape_literal(job.input);
+        const auto call  = job.engine == "template"
+                               ? fmt::format("interpret_bf_ex(\"{}\"_static, \"{}\"_static)", code, input)
+                               : fmt::format(
+                                    "interpret_bf_constexpr_ex<bf_options{{.detect_cycles = true}}>(\"{}\"_static, "
+                                    "\"{}\"_static)",
+                                    code,
+                                    input);
+
+        body += fmt::format(
+            "\n"
+            "// {}{}{} on the {} engine, {} ops\n"
+            "constexpr auto {}_result = {};\n"
+            "constinit const result {} = {{\"{}\", {}_result.first.to_string_view(), {}_result.second}};\n",
+            job.code_path,
+            job.input_path.empty() ? "" : " with ",
+            job.input_path,
+            job.engine,
+            job.ops,
+            job.name,
+            call,
+            job.name,
+            job.name,
+            job.name,
+            job.name);
+    }
+
+    return fmt::format(
+        "// generated by bf_batch from {}, shard {} of {}\n"
+        "#include \"bf_batch/table.hpp\"\n"
+        "\n"
+        "{}"
+        "\n"
+        "namespace bf_batch\n"
+        "{{{}"
+        "}} // namespace bf_batch\n",
+        list_path,
+        shard + 1,
+        shards,
+        headers ? "#include \"bf_constexpr.hpp\"\n#include \"bf_interpreter.hpp\"\n#include \"type_helpers.hpp\"\n"
+                : "import compile_time_bf;\n",
+        body);
+}
+
+auto table_header(const std::string& list_path, const std::vector<batch_job>& jobs) -> std::string
+{
+    std::string externs;
+    for (const auto& job : jobs)
+    {
+        externs += fmt::format("extern const result {};\n", job.name);
+    }
+
+    return fmt::format(
+        "// generated by bf_batch from {}\n"
+        "#pragma once\n"
+        "\n"
+        "#include <array>\n"
+        "#include <cstddef>\n"
+        "#include <string_view>\n"
+        "\n"
+        "namespace bf_batch\n"
+        "{{\n"
+        "// one job's result, evaluated at compile time by the shard the job went to\n"
+        "struct result\n"
+        "{{\n"
+        "    std::string_view name;\n"
+        "    std::string_view output;\n"
+        "    std::size_t      memory_usage = 0;\n"
+        "}};\n"
+        "\n"
+        "{}"
+        "\n"
+        "// every job in the order of the job list\n"
+        "extern const std::array<const result*, {}> table;\n"
+        "\n"
+        "inline auto lookup(std::string_view name) -> const result*\n"
+        "{{\n"
+        "    for (const auto* job : table)\n"
+        "    {{\n"
+        "        if (job->name == name)\n"
+        "        {{\n"
+        "            return job;\n"
+        "        }}\n"
+        "    }}\n"
+        "\n"
+        "    return nullptr;\n"
+        "}}\n"
+        "}} // namespace bf_batch\n",
+        list_path,
+        externs,
+        jobs.size());
+}
+
+auto table_source(const std::string& list_path, const std::vector<batch_job>& jobs) -> std::string
+{
+    std::string entries;
+    for (const auto& job : jobs)
+    {
+        entries += fmt::format("{}&{}", entries.empty() ? "" : ", ", job.name);
+    }
+
+    return fmt::format(
+        "// generated by bf_batch from {}\n"
+        "#include \"bf_batch/table.hpp\"\n"
+        "\n"
+        "namespace bf_batch\n"
+        "{{\n"
+        "constinit const std::array<const result*, {}> table = {{{{{}}}}};\n"
+        "}} // namespace bf_batch\n",
+        list_path,
+        jobs.size(),
+        entries);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool        headers = argc > 1 && std::string_view{argv[1]} == "--headers";
+    const int         first   = headers ? 2 : 1;
+    const std::size_t shards  = argc == first + 3 ? std::stoull(argv[first]) : 0;
+    if (shards == 0)
+    {
+        fmt::print(stderr, "usage: {} [--headers] <shards> <job list> <output dir>\n", argv[0]);
+        return 2;
+    }
+
+    const std::string           list_path = argv[first + 1];
+    const std::filesystem::path output    = argv[first + 2];
+
+    std::vector<batch_job> jobs;
+    if (!read_jobs(list_path, jobs))
+    {
+        return 2;
+    }
+
+    for (auto& job : jobs)
+    {
+        if (!check(job))
+        {
+            return 1;
+        }
+    }
+
+    // a shard without jobs would be a translation unit of nothing, with fewer jobs than shards there are fewer shards.
+    // The Makefile works out the same count
+    const auto used = std::min(shards, jobs.size());
+    const auto load = balance(jobs, used);
+
+    std::filesystem::create_directories(output);
+    for (std::size_t shard = 0; shard < used; ++shard)
+    {
+        write_if_changed(
+            output / fmt::format("shard_{}.cpp", shard),
+            shard_source(list_path, jobs, shard, used, headers));
+
+        std::string names;
+        for (const auto& job : jobs)
+        {
+            names += job.shard == shard ? " " + job.name : "";
+        }
+        fmt::print(stderr, "shard {}: {} ops,{}\n", shard, load[shard], names);
+    }
+
+    // shards of an earlier run with more of them and their objects, nothing links them anymore
+    for (const auto& entry : std::filesystem::directory_iterator{output})
+    {
+        const auto name = entry.path().filename().string();
+        if (name.starts_with("shard_") && std::stoull(name.substr(6)) >= used)
+        {
+            std::filesystem::remove(entry.path());
+        }
+    }
+    write_if_changed(output / "table.hpp", table_header(list_path, jobs));
+    write_if_changed(output / "table.cpp", table_source(list_path, jobs));
+}
@@ -0,0 +1,152 @@
+// build-time result cache: evaluates a brainfuck program once at runtime and writes a header holding the result as a
+// `basic_static_string` literal, so translation units using it never run the program through a compile-time engine.
+//
+//   bf_cache [--detect-cycles] <cache dir> <name> <code file> [input file] > bf_cached/<name>.hpp
+//
+// the header defines `bf_cached::<name>`, so <name> has to be an identifier. Entries are keyed by a hash of (engine
+// policy, code, input) and hold the members of that struct, so programs sharing an entry still get a struct each. A hit
+// copies the stored entry, a miss runs the constexpr engine's machine at runtime (same semantics, same memory usage)
+// and stores the entry for the next build
+#include "bf_constexpr.hpp"
+#include "tool_io.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+namespace
+{
+// bumped whenever the entry format or an engine's observable behaviour changes, invalidating every entry
+constexpr std::string_view bf_cache_version = "2";
+
+auto fnv1a(std::string_view data, std::uint64_t hash = 0xcbf29ce484222325ull) -> std::uint64_t
+{
+    for (const auto c : data)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+auto evaluate(std::string_view code, std::string_view input, const bf_options& options) -> std::optional<std::string>
+{
+    std::string output;
+    const auto  summary = bf_constexpr_run(code, input, options, [&](char c) { output += c; });
+
+    if (summary.status != bf_status::ok)
+    {
+        fmt::print(
+            stderr,
+            "Brainfuck Error: {} at code offsets [{}, {})\n",
+            bf_status_message(summary.status),
+            summary.error_begin,
+            summary.error_end);
+        return std::nullopt;
+    }
+
+    return fmt::format(
+        "    static constexpr std::size_t memory_usage = {};\n"
+        "    using output                              = decltype(\"{}\"_static)::PType;\n",
+        summary.memory_usage,
+        escape_literal(output));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bf_options options;
+
+    int arg = 1;
+    if (arg < argc && std::string_view{argv[arg]} == "--detect-cycles")
+    {
+        options.detect_cycles = true;
+        ++arg;
+    }
+
+    if (argc - arg < 3 || argc - arg > 4)
+    {
+        fmt::print(stderr, "usage: {} [--detect-cycles] <cache dir> <name> <code file> [input file]\n", argv[0]);
+        return 2;
+    }
+
+    const std::filesystem::path cache_dir = argv[arg];
+    const std::string_view      name      = argv[arg + 1];
+    const auto                  code      = read_file(argv[arg + 2]);
+    const auto                  input     = argc - arg == 4 ? read_file(argv[arg + 3]) : std::string{};
+
+    if (!is_identifier(name))
+    {
+        fmt::print(stderr, "bf_cache: `{}` can't name the struct bf_cached::{}, use a C++ identifier\n", name, name);
+        return 2;
+    }
+
+    if (!code || !input)
+    {
+        fmt::print(stderr, "bf_cache: can't read {}\n", !code ? argv[arg + 2] : argv[arg + 3]);
+        return 2;
+    }
+
+    // the policy is every input to the result besides the program itself, the separators keep e.g. code "ab" + input
+    // "c" apart from code "a" + input "bc"
+    const auto policy = fmt::format("bf_cache {} constexpr detect_cycles={}", bf_cache_version, options.detect_cycles);
+    auto       hash   = fnv1a(policy);
+    hash              = fnv1a(std::string_view{"\0", 1}, hash);
+    hash              = fnv1a(*code, hash);
+    hash              = fnv1a(std::string_view{"\0", 1}, hash);
+    hash              = fnv1a(*input, hash);
+
+    const auto key        = fmt::format("{:016x}", hash);
+    const auto entry_path = cache_dir / (key + ".hpp");
+
+    auto entry = read_file(entry_path);
+    if (!entry)
+    {
+        entry = evaluate(*code, *input, options);
+        if (!entry)
+        {
+            return 1;
+        }
+
+        // written to a temporary first so a parallel build never reads a half written entry, and a short write is
+        // never published as one every later build would take for a hit
+        std::filesystem::create_directories(cache_dir);
+        const auto    temporary = cache_dir / (key + ".hpp." + std::to_string(::getpid()));
+        std::ofstream file{temporary, std::ios::binary};
+        file << *entry;
+        file.close();
+        if (!file)
+        {
+            std::filesystem::remove(temporary);
+            fmt::print(stderr, "bf_cache: can't write {}\n", temporary.string());
+            return 1;
+        }
+        std::filesystem::rename(temporary, entry_path);
+    }
+
+    fmt::print(
+        "// generated by bf_cache from {}, cache key {}\n"
+        "#pragma once\n"
+        "\n"
+        "#include \"type_helpers.hpp\"\n"
+        "\n"
+        "namespace bf_cached\n"
+        "{{\n"
+        "struct {}\n"
+        "{{\n"
+        "{}"
+        "}};\n"
+        "}} // namespace bf_cached\n",
+        argv[arg + 2],
+        key,
+        name,
+        *entry);
+}
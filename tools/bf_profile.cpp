@@ -0,0 +1,94 @@
+// runs a brainfuck program on the runtime engine with `bf_profiler` attached. The program's output goes to stdout,
+// the hot loop report to stderr and, with --collapsed, the collapsed stacks to a file for a flamegraph tool.
+//
+//   bf_profile [--interval <ops>] [--top <loops>] [--collapsed <file>] <code file> [input file]
+//   flamegraph.pl profile.folded > profile.svg
+#include "bf_constexpr.hpp"
+#include "bf_profiler.hpp"
+#include "tool_io.hpp"
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+int main(int argc, char** argv)
+{
+    std::uint64_t interval  = 1024;
+    std::size_t   top       = 10;
+    const char*   collapsed = nullptr;
+
+    int arg = 1;
+    for (; arg + 1 < argc && std::string_view{argv[arg]}.starts_with("--"); arg += 2)
+    {
+        const std::string_view option = argv[arg];
+        if (option == "--interval")
+        {
+            interval = std::stoull(argv[arg + 1]);
+        }
+        else if (option == "--top")
+        {
+            top = std::stoull(argv[arg + 1]);
+        }
+        else if (option == "--collapsed")
+        {
+            collapsed = argv[arg + 1];
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (argc - arg < 1 || argc - arg > 2 || interval == 0)
+    {
+        fmt::print(
+            stderr,
+            "usage: {} [--interval <ops>] [--top <loops>] [--collapsed <file>] <code file> [input file]\n",
+            argv[0]);
+        return 2;
+    }
+
+    const auto code  = read_file(argv[arg]);
+    const auto input = argc - arg == 2 ? read_file(argv[arg + 1]) : std::string{};
+    if (!code || !input)
+    {
+        fmt::print(stderr, "bf_profile: can't read {}\n", !code ? argv[arg] : argv[arg + 1]);
+        return 2;
+    }
+
+    bf_constexpr_machine machine{*code, *input};
+    bf_profiler          profiler{machine.program, *code, interval};
+
+    auto       output  = [](char c) { std::putchar(c); };
+    const auto summary = machine.run(bf_options{}, output, profiler);
+    std::fflush(stdout);
+
+    if (summary.status != bf_status::ok)
+    {
+        fmt::print(
+            stderr,
+            "Brainfuck Error: {} at code offsets [{}, {})\n",
+            bf_status_message(summary.status),
+            summary.error_begin,
+            summary.error_end);
+    }
+
+    profiler.write_hot_loops(stderr, top);
+
+    if (collapsed != nullptr)
+    {
+        std::FILE* file = std::fopen(collapsed, "w");
+        if (file == nullptr)
+        {
+            fmt::print(stderr, "bf_profile: can't write {}\n", collapsed);
+            return 2;
+        }
+
+        profiler.write_collapsed(file);
+        std::fclose(file);
+    }
+
+    return summary.status == bf_status::ok ? 0 : 1;
+}
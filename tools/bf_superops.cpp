@@ -0,0 +1,303 @@
+// profile-guided superinstructions: runs every program of a workload on the runtime engine with `bf_profiler`
+// attached and picks the runs of add/move ops whose fusion saves the most dispatches. The set is written as a header
+// with a fused handler per superinstruction for the runtime engine's machine, and for `interpret_bf_fused`. The
+// dispatch counts of every program before and after go to stderr.
+//
+//   bf_superops [--top <superinstructions>] [--max-length <ops>] <name> <code file>... > bf_superops/<name>.hpp
+//
+// a program's input is the file next to it named like it with an .in extension, if there is one. The set is picked
+// greedily: each round profiles the programs fused with the superinstructions picked so far, so a run already covered
+// by a longer superinstruction doesn't count again
+#include "bf_constexpr.hpp"
+#include "bf_profiler.hpp"
+#include "tool_io.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// the superinstructions picked so far, executed by interpreting their ops instead of a generated handler
+struct picked_superops
+{
+    static inline std::deque<std::string>         codes;
+    static inline std::vector<bf_superop>         set;
+    static inline std::vector<std::vector<bf_op>> patterns;
+    static inline std::vector<std::uint64_t>      saved;
+
+    static auto add(const std::string& code, std::uint64_t saved_dispatches) -> void
+    {
+        codes.push_back(code);
+        set.push_back(bf_superop{codes.back()});
+        patterns.push_back(bf_program{codes.back()}.ops);
+        saved.push_back(saved_dispatches);
+    }
+
+    template<typename Machine>
+    static auto run(Machine& machine, int superop) -> void
+    {
+        std::ptrdiff_t offset = 0;
+        for (const auto& op : patterns[static_cast<std::size_t>(superop)])
+        {
+            if (op.kind == bf_op_kind::add)
+            {
+                machine.fused_add(offset, op.arg);
+            }
+            else
+            {
+                offset += op.arg;
+            }
+        }
+        machine.fused_move(offset);
+    }
+};
+
+using picked_machine = bf_basic_constexpr_machine<bf_vector_tape, picked_superops>;
+
+struct workload_program
+{
+    std::string   path;
+    std::string   code;
+    std::string   input;
+    std::string   output     = {}; // of the unfused run, what the fused one is checked against
+    std::uint64_t dispatches = 0;  // executed ops unfused
+};
+
+struct profile_result
+{
+    std::string                              output;
+    std::uint64_t                            dispatches = 0;
+    std::vector<bf_profiler::sequence_stats> sequences;
+};
+
+auto profile(const workload_program& program, std::size_t max_length) -> profile_result
+{
+    picked_machine machine{program.code, program.input};
+    bf_profiler    profiler{machine.program, program.code, static_cast<std::uint64_t>(-1)};
+
+    profile_result result;
+    auto           output = [&](char c) { result.output += c; };
+    machine.run(bf_options{}, output, profiler);
+
+    for (const auto count : profiler.counts)
+    {
+        result.dispatches += count;
+    }
+    result.sequences = profiler.op_sequences(max_length);
+    return result;
+}
+
+// a write per cell the run touches, in the order it first touches them, and the pointer move at the end
+auto handler(const std::vector<bf_op>& pattern) -> std::string
+{
+    std::vector<std::pair<std::ptrdiff_t, int>> writes;
+    std::ptrdiff_t                              offset = 0;
+    for (const auto& op : pattern)
+    {
+        if (op.kind == bf_op_kind::move)
+        {
+            offset += op.arg;
+            continue;
+        }
+
+        auto found = std::find_if(writes.begin(), writes.end(), [&](const auto& w) { return w.first == offset; });
+        if (found == writes.end())
+        {
+            writes.emplace_back(offset, op.arg);
+        }
+        else
+        {
+            found->second += op.arg;
+        }
+    }
+
+    std::string result;
+    for (const auto& [cell, delta] : writes)
+    {
+        result += fmt::format("                machine.fused_add({}, {});\n", cell, delta);
+    }
+    if (offset != 0)
+    {
+        result += fmt::format("                machine.fused_move({});\n", offset);
+    }
+
+    return result;
+}
+
+auto write_header(std::string_view name, const std::vector<workload_program>& programs) -> void
+{
+    std::string sources;
+    for (const auto& program : programs)
+    {
+        sources += " " + program.path;
+    }
+
+    std::string set;
+    std::string cases;
+    for (std::size_t i = 0; i < picked_superops::set.size(); ++i)
+    {
+        const auto code = picked_superops::set[i].code;
+        set += fmt::format("        {{\"{}\"}}, // {} dispatches saved\n", code, picked_superops::saved[i]);
+        cases += fmt::format(
+            "            case {}: // {}\n{}                break;\n",
+            i,
+            code,
+            handler(picked_superops::patterns[i]));
+    }
+
+    fmt::print(
+        "// generated by bf_superops from{}\n"
+        "// the superinstructions saving the most dispatches in a profile of each program\n"
+        "#pragma once\n"
+        "\n"
+        "#include \"bf_program.hpp\"\n"
+        "\n"
+        "#include <array>\n"
+        "\n"
+        "namespace bf_superops\n"
+        "{{\n"
+        "struct {}\n"
+        "{{\n"
+        "    static constexpr std::array<bf_superop, {}> set = {{{{\n"
+        "{}"
+        "    }}}};\n"
+        "\n"
+        "    template<typename Machine>\n"
+        "    static constexpr auto run([[maybe_unused]] Machine& machine, int superop) -> void\n"
+        "    {{\n"
+        "        switch (superop)\n"
+        "        {{\n"
+        "{}"
+        "        }}\n"
+        "    }}\n"
+        "}};\n"
+        "}} // namespace bf_superops\n",
+        sources,
+        name,
+        picked_superops::set.size(),
+        set,
+        cases);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t top        = 8;
+    std::size_t max_length = 8;
+
+    int arg = 1;
+    for (; arg + 1 < argc && std::string_view{argv[arg]}.starts_with("--"); arg += 2)
+    {
+        const std::string_view option = argv[arg];
+        if (option == "--top")
+        {
+            top = std::stoull(argv[arg + 1]);
+        }
+        else if (option == "--max-length")
+        {
+            max_length = std::stoull(argv[arg + 1]);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (argc - arg < 2 || max_length < 2)
+    {
+        fmt::print(
+            stderr,
+            "usage: {} [--top <superinstructions>] [--max-length <ops>] <name> <code file>...\n",
+            argv[0]);
+        return 2;
+    }
+
+    const std::string_view        name = argv[arg];
+    std::vector<workload_program> programs;
+    for (int i = arg + 1; i < argc; ++i)
+    {
+        const auto input_path = std::filesystem::path{argv[i]}.replace_extension(".in");
+        const auto code       = read_file(argv[i]);
+        const auto input      = std::filesystem::exists(input_path) ? read_file(input_path) : std::string{};
+        if (!code || !input)
+        {
+            fmt::print(stderr, "bf_superops: can't read {}\n", !code ? argv[i] : input_path.string());
+            return 2;
+        }
+
+        programs.push_back(workload_program{argv[i], *code, *input});
+    }
+
+    for (auto& program : programs)
+    {
+        const auto result  = profile(program, max_length);
+        program.output     = result.output;
+        program.dispatches = result.dispatches;
+    }
+
+    while (picked_superops::set.size() < top)
+    {
+        std::vector<bf_profiler::sequence_stats> merged;
+        for (const auto& program : programs)
+        {
+            for (const auto& sequence : profile(program, max_length).sequences)
+            {
+                auto found = std::find_if(merged.begin(), merged.end(), [&](const auto& s) {
+                    return s.code == sequence.code;
+                });
+                if (found == merged.end())
+                {
+                    merged.push_back(sequence);
+                }
+                else
+                {
+                    found->executed += sequence.executed;
+                    found->saved += sequence.saved;
+                }
+            }
+        }
+
+        const auto best = std::max_element(merged.begin(), merged.end(), [](const auto& a, const auto& b) {
+            return a.saved < b.saved;
+        });
+        if (best == merged.end() || best->saved == 0)
+        {
+            break;
+        }
+
+        picked_superops::add(best->code, best->saved);
+    }
+
+    int status = 0;
+    for (const auto& program : programs)
+    {
+        const auto fused = profile(program, max_length);
+        if (fused.output != program.output)
+        {
+            fmt::print(stderr, "bf_superops: {} gives a different output with superinstructions\n", program.path);
+            status = 1;
+        }
+
+        const auto saved     = static_cast<double>(program.dispatches - fused.dispatches);
+        const auto reduction = program.dispatches == 0 ? 0.0 : 100.0 * saved / static_cast<double>(program.dispatches);
+        fmt::print(
+            stderr,
+            "{}: {} dispatches, {} with superinstructions ({:.1f}% fewer)\n",
+            program.path,
+            program.dispatches,
+            fused.dispatches,
+            reduction);
+    }
+
+    write_header(name, programs);
+    return status;
+}
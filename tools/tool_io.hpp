@@ -0,0 +1,55 @@
+#pragma once
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// shared by the command line tools, none of this is needed by the engines themselves
+
+// whether `name` can name a generated variable or struct, the keywords aside
+inline auto is_identifier(std::string_view name) -> bool
+{
+    auto word = [](char c) { return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); };
+    return !name.empty() && word(name[0]) && std::all_of(name.begin(), name.end(), [&](char c) {
+        return word(c) || (c >= '0' && c <= '9');
+    });
+}
+
+inline auto read_file(const std::filesystem::path& path) -> std::optional<std::string>
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+// the contents of a string literal: every character outside printable ASCII, and the ones with a meaning inside a
+// literal, as a 3 digit octal escape which can't run into the character after it the way a \x escape can
+inline auto escape_literal(std::string_view data) -> std::string
+{
+    std::string result;
+    for (const auto c : data)
+    {
+        const auto byte = static_cast<std::uint8_t>(c);
+        if (byte < 0x20 || byte > 0x7e || c == '"' || c == '\\' || c == '?')
+        {
+            result += fmt::format("\\{:03o}", byte);
+        }
+        else
+        {
+            result += c;
+        }
+    }
+
+    return result;
+}